@@ -4,23 +4,35 @@
 #include "i2c_device.hpp"
 #include "mcp23017_config.hpp"
 #include "mcp23017_registers.hpp"
+#include "mcp23s17_device.hpp"
+#include "soft_i2c_device.hpp"
+#include <array>
+#include <concepts>
 
 namespace MCP23017 {
 
-    struct MCP23017 {
-    public:
-        using I2CDevice = Utility::I2CDevice;
+    template <typename T>
+    concept Transport = requires(T const& device, std::uint8_t const reg_address, std::uint8_t const byte) {
+        { device.is_initialized() } -> std::same_as<bool>;
+        { device.read_byte(reg_address) } -> std::same_as<std::uint8_t>;
+        { device.write_byte(reg_address, byte) };
+        { device.template read_bytes<2UL>(reg_address) } -> std::same_as<std::array<std::uint8_t, 2UL>>;
+        { device.write_bytes(reg_address, std::array<std::uint8_t, 2UL>{}) };
+    };
 
-        MCP23017() noexcept = default;
-        MCP23017(I2CDevice&& i2c_device, PortConfig const& port_a_config, PortConfig const& port_b_config) noexcept;
+    template <Transport Device>
+    struct MCP23X17 {
+    public:
+        MCP23X17() noexcept = default;
+        MCP23X17(Device&& device, PortConfig const& port_a_config, PortConfig const& port_b_config) noexcept;
 
-        MCP23017(MCP23017 const& other) = delete;
-        MCP23017(MCP23017&& other) noexcept = default;
+        MCP23X17(MCP23X17 const& other) = delete;
+        MCP23X17(MCP23X17&& other) noexcept = default;
 
-        MCP23017& operator=(MCP23017 const& other) = delete;
-        MCP23017& operator=(MCP23017&& other) noexcept = default;
+        MCP23X17& operator=(MCP23X17 const& other) = delete;
+        MCP23X17& operator=(MCP23X17&& other) noexcept = default;
 
-        ~MCP23017() noexcept;
+        ~MCP23X17() noexcept;
 
         PinState get_pin_state(Port const port, PinNum const pin_num) const noexcept;
         void set_pin_state(Port const port, PinNum const pin_num, PinState const pin_state) const noexcept;
@@ -36,6 +48,10 @@ namespace MCP23017 {
         void reset_pin(Port const port, PinNum const pin_num) const noexcept;
         void reset_pins(Port const port) const noexcept;
 
+        // put writes buffered by the transport on the bus; no-ops for unbuffered transports
+        void flush() const noexcept;
+        void poll() const noexcept;
+
     private:
         std::uint8_t read_byte(std::uint8_t const reg_address) const noexcept;
 
@@ -84,22 +100,27 @@ namespace MCP23017 {
 
         Bank bank_{};
 
-        I2CDevice i2c_device_{};
+        Device device_{};
     };
 
+    template <Transport Device>
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, SIZE> MCP23017::read_bytes(std::uint8_t const reg_address) const noexcept
+    inline std::array<std::uint8_t, SIZE> MCP23X17<Device>::read_bytes(std::uint8_t const reg_address) const noexcept
     {
-        return this->i2c_device_.read_bytes<SIZE>(reg_address);
+        return this->device_.template read_bytes<SIZE>(reg_address);
     }
 
+    template <Transport Device>
     template <std::size_t SIZE>
-    inline void MCP23017::write_bytes(std::uint8_t const reg_address,
-                                      std::array<std::uint8_t, SIZE> const& bytes) const noexcept
+    inline void MCP23X17<Device>::write_bytes(std::uint8_t const reg_address,
+                                              std::array<std::uint8_t, SIZE> const& bytes) const noexcept
     {
-        this->i2c_device_.write_bytes(reg_address, bytes);
+        this->device_.write_bytes(reg_address, bytes);
     }
 
+    using MCP23017 = MCP23X17<Utility::I2CDevice>;
+    using MCP23S17 = MCP23X17<MCP23S17Device>;
+
 }; // namespace MCP23017
 
 #endif // MCP23017_HPP
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define MCP23017_CONFIG_HPP
 
 #include <cstdint>
+#include <utility>
 
 namespace MCP23017 {
 
@@ -0,0 +1,52 @@
+#include "mcp23s17_device.hpp"
+#include <utility>
+
+namespace MCP23017 {
+
+    MCP23S17Device::MCP23S17Device(SPIDevice&& spi_device,
+                                   DevAddress const dev_address,
+                                   std::uint8_t const iocon) noexcept :
+        spi_device_{std::forward<SPIDevice>(spi_device)},
+        hardware_address_{static_cast<std::uint8_t>(std::to_underlying(dev_address) & HARDWARE_ADDRESS_MASK)},
+        iocon_{static_cast<std::uint8_t>(iocon | IOCON_HAEN)}
+    {
+        this->initialize();
+    }
+
+    std::uint8_t MCP23S17Device::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        return this->read_bytes<1UL>(reg_address)[0];
+    }
+
+    void MCP23S17Device::write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+    {
+        this->write_bytes(reg_address, std::array<std::uint8_t, 1UL>{byte});
+    }
+
+    bool MCP23S17Device::is_initialized() const noexcept
+    {
+        return this->initialized_;
+    }
+
+    std::uint8_t MCP23S17Device::write_opcode() const noexcept
+    {
+        return OPCODE_BASE | static_cast<std::uint8_t>(this->hardware_address_ << 1U);
+    }
+
+    std::uint8_t MCP23S17Device::read_opcode() const noexcept
+    {
+        return this->write_opcode() | OPCODE_READ;
+    }
+
+    void MCP23S17Device::initialize() noexcept
+    {
+        if (this->spi_device_.is_initialized()) {
+            // Until HAEN is set every chip on the chip select ignores A2..A0, so this write reaches all of them.
+            // A read-modify-write would have them all drive SO at once, so the configured IOCON is written whole
+            // with HAEN merged in; chips sharing a chip select must be given the same IOCON.
+            this->write_byte(IOCON_DEFAULT_ADDRESS, this->iocon_);
+            this->initialized_ = true;
+        }
+    }
+
+}; // namespace MCP23017
@@ -0,0 +1,86 @@
+#ifndef MCP23S17_DEVICE_HPP
+#define MCP23S17_DEVICE_HPP
+
+#include "mcp23017_config.hpp"
+#include "spi_device.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace MCP23017 {
+
+    struct MCP23S17Device {
+    public:
+        using SPIDevice = Utility::SPIDevice;
+
+        static constexpr std::uint8_t IOCON_RESET_VALUE{0x00U};
+
+        MCP23S17Device() noexcept = default;
+        MCP23S17Device(SPIDevice&& spi_device,
+                       DevAddress const dev_address,
+                       std::uint8_t const iocon = IOCON_RESET_VALUE) noexcept;
+
+        MCP23S17Device(MCP23S17Device const& other) = delete;
+        MCP23S17Device(MCP23S17Device&& other) noexcept = default;
+
+        MCP23S17Device& operator=(MCP23S17Device const& other) = delete;
+        MCP23S17Device& operator=(MCP23S17Device&& other) noexcept = default;
+
+        ~MCP23S17Device() noexcept = default;
+
+        template <std::size_t SIZE>
+        std::array<std::uint8_t, SIZE> read_bytes(std::uint8_t const reg_address) const noexcept;
+        std::uint8_t read_byte(std::uint8_t const reg_address) const noexcept;
+
+        template <std::size_t SIZE>
+        void write_bytes(std::uint8_t const reg_address, std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
+        void write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+        [[nodiscard]] bool is_initialized() const noexcept;
+
+    private:
+        static constexpr std::uint8_t OPCODE_BASE{0b0100'0000U};
+        static constexpr std::uint8_t OPCODE_READ{0b0000'0001U};
+        static constexpr std::uint8_t HARDWARE_ADDRESS_MASK{0b0000'0111U};
+        static constexpr std::uint8_t IOCON_DEFAULT_ADDRESS{0x0AU};
+        static constexpr std::uint8_t IOCON_HAEN{0b0000'1000U};
+
+        std::uint8_t write_opcode() const noexcept;
+        std::uint8_t read_opcode() const noexcept;
+
+        void initialize() noexcept;
+
+        bool initialized_{false};
+
+        SPIDevice spi_device_{};
+        std::uint8_t hardware_address_{};
+        std::uint8_t iocon_{IOCON_RESET_VALUE};
+    };
+
+    template <std::size_t SIZE>
+    std::array<std::uint8_t, SIZE> MCP23S17Device::read_bytes(std::uint8_t const reg_address) const noexcept
+    {
+        std::array<std::uint8_t, 2UL + SIZE> transmit{};
+        transmit[0] = this->read_opcode();
+        transmit[1] = reg_address;
+        auto const receive{this->spi_device_.transmit_receive_bytes(transmit)};
+
+        std::array<std::uint8_t, SIZE> read{};
+        std::memcpy(read.data(), receive.data() + 2UL, SIZE);
+        return read;
+    }
+
+    template <std::size_t SIZE>
+    void MCP23S17Device::write_bytes(std::uint8_t const reg_address,
+                                     std::array<std::uint8_t, SIZE> const& bytes) const noexcept
+    {
+        std::array<std::uint8_t, 2UL + SIZE> write{};
+        write[0] = this->write_opcode();
+        write[1] = reg_address;
+        std::memcpy(write.data() + 2UL, bytes.data(), SIZE);
+        this->spi_device_.transmit_bytes(write);
+    }
+
+}; // namespace MCP23017
+
+#endif // MCP23S17_DEVICE_HPP
@@ -1,13 +1,30 @@
 #include "cnt_device.hpp"
+#include "handle_registry.hpp"
+#include "timer_clock.hpp"
 
 namespace Utility {
 
+    namespace {
+
+        HandleRegistry<TIMHandle, CNTDevice, 4U> cnt_device_registry{};
+
+    }; // namespace
+
     CNTDevice::CNTDevice(TIMHandle const timer, std::uint32_t const counter_period) noexcept :
         timer_{timer}, counter_period_{counter_period}
     {
         this->initialize();
     }
 
+    CNTDevice::CNTDevice(TIMHandle const timer,
+                         std::uint32_t const counter_period,
+                         TIMHandle const capture_timer,
+                         std::uint32_t const capture_channel) noexcept :
+        timer_{timer}, counter_period_{counter_period}, capture_timer_{capture_timer}, capture_channel_{capture_channel}
+    {
+        this->initialize();
+    }
+
     CNTDevice::~CNTDevice() noexcept
     {
         this->deinitialize();
@@ -18,28 +35,229 @@ namespace Utility {
         if (!this->initialized_) {
             return std::optional<std::uint32_t>{std::nullopt};
         }
-        this->count_ = this->get_current_count() % this->counter_period_;
-        return std::optional<std::uint32_t>{this->count_};
+        return std::optional<std::uint32_t>{this->get_current_count() % this->counter_period_};
+    }
+
+    std::optional<std::int32_t> CNTDevice::get_count_difference() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::optional<std::int32_t>{std::nullopt};
+        }
+        auto const position{this->read_position()};
+        auto const difference{position - this->count_position_};
+        this->count_position_ = position;
+        return std::optional<std::int32_t>{static_cast<std::int32_t>(difference)};
+    }
+
+    std::optional<std::int64_t> CNTDevice::get_position() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::optional<std::int64_t>{std::nullopt};
+        }
+        return std::optional<std::int64_t>{this->read_position()};
+    }
+
+    std::optional<std::int64_t> CNTDevice::get_position_difference() const noexcept
+    {
+        if (!this->initialized_) {
+            return std::optional<std::int64_t>{std::nullopt};
+        }
+        auto const position{this->read_position()};
+        auto const difference{position - this->position_};
+        this->position_ = position;
+        return std::optional<std::int64_t>{difference};
+    }
+
+    void CNTDevice::set_velocity_averaging(std::size_t const window) noexcept
+    {
+        this->velocity_window_ = std::clamp<std::size_t>(window, 1U, MAX_VELOCITY_WINDOW);
+        this->velocity_fill_ = std::min(this->velocity_fill_, this->velocity_window_);
+    }
+
+    std::optional<std::int64_t> CNTDevice::update_velocity() noexcept
+    {
+        if (!this->initialized_ || this->capture_timer_ == nullptr) {
+            return std::optional<std::int64_t>{std::nullopt};
+        }
+
+        auto const snapshot{this->read_edge_snapshot()};
+        auto const elapsed{this->capture_ticks_between(this->last_now_, snapshot.now)};
+        this->time_ += elapsed;
+        this->last_now_ = snapshot.now;
+
+        auto const counts{snapshot.position - this->edge_position_};
+        if (counts != 0LL) {
+            // new counts mean the last captured edge happened within this sample interval
+            auto const since_edge{std::min(this->capture_ticks_between(snapshot.capture, snapshot.now), elapsed)};
+            auto const edge_time{this->time_ - since_edge};
+            if (this->has_edge_ && edge_time > this->edge_time_) {
+                // one slot per sample interval: all counts since the previous sample's last edge, timed edge to edge
+                this->window_counts_[this->velocity_head_] = static_cast<std::int32_t>(counts);
+                this->window_ticks_[this->velocity_head_] = static_cast<std::uint32_t>(edge_time - this->edge_time_);
+                this->velocity_head_ = (this->velocity_head_ + 1UL) % MAX_VELOCITY_WINDOW;
+                this->velocity_fill_ = std::min(this->velocity_fill_ + 1U, this->velocity_window_);
+                this->velocity_q16_ = this->window_velocity_q16();
+            }
+            this->has_edge_ = true;
+            this->edge_position_ = snapshot.position;
+            this->edge_time_ = edge_time;
+            return std::optional<std::int64_t>{this->velocity_q16_};
+        }
+
+        if (!this->has_edge_) {
+            return std::optional<std::int64_t>{this->velocity_q16_};
+        }
+
+        auto const idle_ticks{this->time_ - this->edge_time_};
+        if (idle_ticks > this->capture_frequency_ * STANDSTILL_TIMEOUT_MS / 1000UL) {
+            this->velocity_fill_ = 0UL;
+            this->velocity_q16_ = 0LL;
+        } else if (idle_ticks > 0UL) {
+            // no edge since the last sample: the speed cannot exceed one count per idle interval
+            auto const bound_q16{
+                static_cast<std::int64_t>((this->capture_frequency_ << VELOCITY_FRACTION_BITS) / idle_ticks)};
+            this->velocity_q16_ = std::clamp(this->velocity_q16_, -bound_q16, bound_q16);
+        }
+        return std::optional<std::int64_t>{this->velocity_q16_};
+    }
+
+    std::optional<std::int64_t> CNTDevice::get_velocity_q16() const noexcept
+    {
+        if (!this->initialized_ || this->capture_timer_ == nullptr) {
+            return std::optional<std::int64_t>{std::nullopt};
+        }
+        return std::optional<std::int64_t>{this->velocity_q16_};
+    }
+
+    HAL_StatusTypeDef CNTDevice::start_sampling(TIMHandle const sample_timer,
+                                                std::span<std::uint32_t> const buffer) noexcept
+    {
+        if (!this->initialized_ || this->sample_timer_ != nullptr || sample_timer == nullptr || buffer.size() < 3U) {
+            return HAL_ERROR;
+        }
+
+        auto* const dma{sample_timer->hdma[TIM_DMA_ID_UPDATE]};
+        if (dma == nullptr || dma->Init.Mode != DMA_CIRCULAR || dma->Init.Direction != DMA_PERIPH_TO_MEMORY ||
+            dma->Init.PeriphInc != DMA_PINC_DISABLE || dma->Init.MemInc != DMA_MINC_ENABLE ||
+            dma->Init.PeriphDataAlignment != DMA_PDATAALIGN_WORD || dma->Init.MemDataAlignment != DMA_MDATAALIGN_WORD) {
+            return HAL_ERROR;
+        }
+
+        std::fill(buffer.begin(), buffer.end(), this->get_current_count());
+        if (HAL_DMA_Start(dma,
+                          static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&this->timer_->Instance->CNT)),
+                          static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(buffer.data())),
+                          static_cast<std::uint32_t>(buffer.size())) != HAL_OK) {
+            return HAL_ERROR;
+        }
+        __HAL_TIM_ENABLE_DMA(sample_timer, TIM_DMA_UPDATE);
+        if (HAL_TIM_Base_Start(sample_timer) != HAL_OK) {
+            __HAL_TIM_DISABLE_DMA(sample_timer, TIM_DMA_UPDATE);
+            HAL_DMA_Abort(dma);
+            return HAL_ERROR;
+        }
+
+        this->sample_timer_ = sample_timer;
+        this->sample_buffer_ = buffer;
+        return HAL_OK;
+    }
+
+    void CNTDevice::stop_sampling() noexcept
+    {
+        if (this->sample_timer_ != nullptr) {
+            HAL_TIM_Base_Stop(this->sample_timer_);
+            __HAL_TIM_DISABLE_DMA(this->sample_timer_, TIM_DMA_UPDATE);
+            HAL_DMA_Abort(this->sample_timer_->hdma[TIM_DMA_ID_UPDATE]);
+            this->sample_timer_ = nullptr;
+            this->sample_buffer_ = {};
+        }
+    }
+
+    bool CNTDevice::is_sampling() const noexcept
+    {
+        return this->sample_timer_ != nullptr;
+    }
+
+    std::size_t CNTDevice::get_latest_positions(std::span<std::int64_t> const positions) const noexcept
+    {
+        if (this->sample_timer_ == nullptr || positions.empty()) {
+            return 0UL;
+        }
+
+        auto* const dma{this->sample_timer_->hdma[TIM_DMA_ID_UPDATE]};
+        auto const size{this->sample_buffer_.size()};
+        auto const count{std::min(positions.size(), size - 2U)};
+        auto const remaining{static_cast<std::size_t>(__HAL_DMA_GET_COUNTER(dma))};
+        auto index{(size - remaining + size - 1U) % size};
+
+        // anchor the newest sample to the extended position, then unwrap backwards sample by sample
+        auto previous{this->sample_buffer_[index]};
+        auto const now{this->read_position()};
+        auto const period{static_cast<std::int64_t>(__HAL_TIM_GET_AUTORELOAD(this->timer_)) + 1LL};
+        auto const now_count{static_cast<std::uint32_t>((now % period + period) % period)};
+        auto position{now - this->count_difference(previous, now_count)};
+        for (std::size_t sample{count}; sample > 0U; --sample) {
+            positions[sample - 1U] = position;
+            index = (index + size - 1U) % size;
+            auto const older{this->sample_buffer_[index]};
+            position -= this->count_difference(older, previous);
+            previous = older;
+        }
+
+        // samples written during the walk may have overwritten the oldest slots before they were read
+        auto const written{(remaining + size - static_cast<std::size_t>(__HAL_DMA_GET_COUNTER(dma))) % size};
+        auto const valid{std::min(count, size - written)};
+        if (valid < count) {
+            std::copy(positions.begin() + (count - valid), positions.begin() + count, positions.begin());
+        }
+        return valid;
     }
 
-    std::optional<std::uint32_t> CNTDevice::get_count_difference() const noexcept
+    void CNTDevice::update_callback() noexcept
     {
-        auto prev_count{this->count_};
-        return this->get_count().transform([prev_count](std::uint32_t const count) { return count - prev_count; });
+        // CR1.DIR may already reflect a reversal after the wrap, the counter side of the wrap does not
+        if (this->get_current_count() < __HAL_TIM_GET_AUTORELOAD(this->timer_) / 2UL) {
+            this->overflows_ = this->overflows_ + 1;
+        } else {
+            this->overflows_ = this->overflows_ - 1;
+        }
     }
 
     void CNTDevice::initialize() noexcept
     {
         if (this->timer_ != nullptr) {
-            if (HAL_TIM_Encoder_Start(this->timer_, TIM_CHANNEL_ALL) == HAL_OK) {
-                this->initialized_ = true;
+            if (!cnt_device_registry.insert(this->timer_, this)) {
+                return;
             }
+            this->timer_->Instance->CR1 = this->timer_->Instance->CR1 | TIM_CR1_URS;
+            __HAL_TIM_CLEAR_FLAG(this->timer_, TIM_FLAG_UPDATE);
+            __HAL_TIM_ENABLE_IT(this->timer_, TIM_IT_UPDATE);
+            if (HAL_TIM_Encoder_Start(this->timer_, TIM_CHANNEL_ALL) != HAL_OK) {
+                return;
+            }
+            if (this->capture_timer_ != nullptr) {
+                if (!IS_TIM_32B_COUNTER_INSTANCE(this->capture_timer_->Instance) ||
+                    __HAL_TIM_GET_AUTORELOAD(this->capture_timer_) != MAX_CAPTURE_RELOAD ||
+                    HAL_TIM_IC_Start(this->capture_timer_, this->capture_channel_) != HAL_OK) {
+                    return;
+                }
+                this->capture_period_ = static_cast<std::uint64_t>(MAX_CAPTURE_RELOAD) + 1UL;
+                this->capture_frequency_ = timer_counter_frequency(this->capture_timer_->Instance);
+            }
+            this->initialized_ = true;
+            this->reset_velocity();
         }
     }
 
     void CNTDevice::deinitialize() noexcept
     {
         if (this->timer_ != nullptr) {
+            this->stop_sampling();
+            __HAL_TIM_DISABLE_IT(this->timer_, TIM_IT_UPDATE);
+            cnt_device_registry.erase(this->timer_);
+            if (this->capture_timer_ != nullptr) {
+                HAL_TIM_IC_Stop(this->capture_timer_, this->capture_channel_);
+            }
             if (HAL_TIM_Encoder_Stop(this->timer_, TIM_CHANNEL_ALL) == HAL_OK) {
                 this->initialized_ = false;
             }
@@ -51,4 +269,98 @@ namespace Utility {
         return static_cast<std::uint32_t>(__HAL_TIM_GetCounter(this->timer_));
     }
 
-}; // namespace Utility
\ No newline at end of file
+    std::int64_t CNTDevice::read_position() const noexcept
+    {
+        auto const primask{__get_PRIMASK()};
+        __disable_irq();
+
+        auto overflows{static_cast<std::int64_t>(this->overflows_)};
+        auto count{this->get_current_count()};
+        auto const period{static_cast<std::int64_t>(__HAL_TIM_GET_AUTORELOAD(this->timer_)) + 1LL};
+        if (__HAL_TIM_GET_FLAG(this->timer_, TIM_FLAG_UPDATE) != 0U) {
+            count = this->get_current_count();
+            overflows += static_cast<std::int64_t>(count) < period / 2LL ? 1LL : -1LL;
+        }
+
+        __set_PRIMASK(primask);
+        return overflows * period + static_cast<std::int64_t>(count);
+    }
+
+    CNTDevice::EdgeSnapshot CNTDevice::read_edge_snapshot() const noexcept
+    {
+        EdgeSnapshot snapshot{};
+        auto capture{__HAL_TIM_GET_COMPARE(this->capture_timer_, this->capture_channel_)};
+        while (true) {
+            snapshot.position = this->read_position();
+            snapshot.now = __HAL_TIM_GET_COUNTER(this->capture_timer_);
+            auto const recapture{__HAL_TIM_GET_COMPARE(this->capture_timer_, this->capture_channel_)};
+            if (recapture == capture) {
+                break;
+            }
+            capture = recapture;
+        }
+        snapshot.capture = capture;
+        return snapshot;
+    }
+
+    std::uint64_t CNTDevice::capture_ticks_between(std::uint64_t const from, std::uint64_t const to) const noexcept
+    {
+        return (to + this->capture_period_ - from) % this->capture_period_;
+    }
+
+    std::int64_t CNTDevice::window_velocity_q16() const noexcept
+    {
+        std::int64_t counts{};
+        std::uint64_t ticks{};
+        for (std::size_t index{1UL}; index <= this->velocity_fill_; ++index) {
+            auto const slot{(this->velocity_head_ + MAX_VELOCITY_WINDOW - index) % MAX_VELOCITY_WINDOW};
+            counts += this->window_counts_[slot];
+            ticks += this->window_ticks_[slot];
+        }
+        if (ticks == 0UL) {
+            return 0LL;
+        }
+
+        auto const magnitude{static_cast<std::uint64_t>(counts < 0LL ? -counts : counts) * this->capture_frequency_};
+        auto const whole{magnitude / ticks};
+        auto const fraction{((magnitude % ticks) << VELOCITY_FRACTION_BITS) / ticks};
+        auto const velocity_q16{static_cast<std::int64_t>((whole << VELOCITY_FRACTION_BITS) | fraction)};
+        return counts < 0LL ? -velocity_q16 : velocity_q16;
+    }
+
+    std::int64_t CNTDevice::count_difference(std::uint32_t const from, std::uint32_t const to) const noexcept
+    {
+        auto const period{static_cast<std::int64_t>(__HAL_TIM_GET_AUTORELOAD(this->timer_)) + 1LL};
+        auto difference{(static_cast<std::int64_t>(to) - static_cast<std::int64_t>(from)) % period};
+        if (difference >= period / 2LL) {
+            difference -= period;
+        } else if (difference < -period / 2LL) {
+            difference += period;
+        }
+        return difference;
+    }
+
+    void CNTDevice::reset_velocity() noexcept
+    {
+        this->velocity_head_ = 0UL;
+        this->velocity_fill_ = 0UL;
+        this->has_edge_ = false;
+        this->time_ = 0UL;
+        this->velocity_q16_ = 0LL;
+        if (this->capture_timer_ != nullptr) {
+            this->edge_position_ = this->read_position();
+            this->last_now_ = __HAL_TIM_GET_COUNTER(this->capture_timer_);
+        }
+    }
+
+}; // namespace Utility
+
+extern "C" {
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
+{
+    if (auto* const cnt_device{Utility::cnt_device_registry.find(htim)}; cnt_device != nullptr) {
+        cnt_device->update_callback();
+    }
+}
+}
@@ -4,27 +4,65 @@
 #include "common.hpp"
 #include "utility.hpp"
 #include <optional>
+#include <span>
 
 namespace Utility {
 
     struct CNTDevice {
     public:
         CNTDevice() noexcept = default;
+        static constexpr std::size_t MAX_VELOCITY_WINDOW{16UL};
+        static constexpr std::uint32_t VELOCITY_FRACTION_BITS{16UL};
+
         CNTDevice(TIMHandle const timer, std::uint32_t const counter_period) noexcept;
+        CNTDevice(TIMHandle const timer,
+                  std::uint32_t const counter_period,
+                  TIMHandle const capture_timer,
+                  std::uint32_t const capture_channel) noexcept;
 
         CNTDevice(CNTDevice const& other) = delete;
-        CNTDevice(CNTDevice&& other) noexcept = default;
+        CNTDevice(CNTDevice&& other) noexcept = delete;
 
         CNTDevice& operator=(CNTDevice const& other) = delete;
-        CNTDevice& operator=(CNTDevice&& other) noexcept = default;
+        CNTDevice& operator=(CNTDevice&& other) noexcept = delete;
 
         ~CNTDevice() noexcept;
 
         [[nodiscard]] std::optional<std::uint32_t> get_count() const noexcept;
-        [[nodiscard]] std::optional<std::uint32_t> get_count_difference() const noexcept;
+        [[nodiscard]] std::optional<std::int32_t> get_count_difference() const noexcept;
+
+        [[nodiscard]] std::optional<std::int64_t> get_position() const noexcept;
+        [[nodiscard]] std::optional<std::int64_t> get_position_difference() const noexcept;
+
+        void set_velocity_averaging(std::size_t const window) noexcept;
+        [[nodiscard]] std::optional<std::int64_t> update_velocity() noexcept;
+        [[nodiscard]] std::optional<std::int64_t> get_velocity_q16() const noexcept;
+
+        HAL_StatusTypeDef start_sampling(TIMHandle const sample_timer, std::span<std::uint32_t> const buffer) noexcept;
+        void stop_sampling() noexcept;
+        [[nodiscard]] bool is_sampling() const noexcept;
+        [[nodiscard]] std::size_t get_latest_positions(std::span<std::int64_t> const positions) const noexcept;
+
+        void update_callback() noexcept;
 
     private:
+        static constexpr std::uint64_t STANDSTILL_TIMEOUT_MS{1000UL};
+        static constexpr std::uint32_t MAX_CAPTURE_RELOAD{0xFFFFFFFFUL};
+
+        struct EdgeSnapshot {
+            std::int64_t position{};
+            std::uint64_t capture{};
+            std::uint64_t now{};
+        };
+
         std::uint32_t get_current_count() const noexcept;
+        std::int64_t read_position() const noexcept;
+
+        EdgeSnapshot read_edge_snapshot() const noexcept;
+        std::uint64_t capture_ticks_between(std::uint64_t const from, std::uint64_t const to) const noexcept;
+        std::int64_t window_velocity_q16() const noexcept;
+        std::int64_t count_difference(std::uint32_t const from, std::uint32_t const to) const noexcept;
+        void reset_velocity() noexcept;
 
         void initialize() noexcept;
         void deinitialize() noexcept;
@@ -34,7 +72,30 @@ namespace Utility {
         TIMHandle timer_{nullptr};
         std::uint32_t counter_period_{};
 
-        std::uint32_t mutable count_{};
+        std::int32_t volatile overflows_{};
+        std::int64_t mutable count_position_{};
+        std::int64_t mutable position_{};
+
+        TIMHandle capture_timer_{nullptr};
+        std::uint32_t capture_channel_{};
+        std::uint64_t capture_period_{};
+        std::uint64_t capture_frequency_{};
+
+        std::size_t velocity_window_{1UL};
+        std::size_t velocity_head_{};
+        std::size_t velocity_fill_{};
+        std::array<std::int32_t, MAX_VELOCITY_WINDOW> window_counts_{};
+        std::array<std::uint32_t, MAX_VELOCITY_WINDOW> window_ticks_{};
+
+        bool has_edge_{false};
+        std::int64_t edge_position_{};
+        std::uint64_t edge_time_{};
+        std::uint64_t time_{};
+        std::uint64_t last_now_{};
+        std::int64_t velocity_q16_{};
+
+        TIMHandle sample_timer_{nullptr};
+        std::span<std::uint32_t> sample_buffer_{};
     };
 
 }; // namespace Utility
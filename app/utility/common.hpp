@@ -16,6 +16,7 @@ namespace Utility {
     using GPIOHandle = GPIO_TypeDef*;
     using UARTHandle = UART_HandleTypeDef*;
     using I2CHandle = I2C_HandleTypeDef*;
+    using DMAHandle = DMA_HandleTypeDef*;
 
 }; // namespace Utility
 
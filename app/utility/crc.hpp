@@ -0,0 +1,172 @@
+#ifndef CRC_HPP
+#define CRC_HPP
+
+#include "utility.hpp"
+#include <concepts>
+#include <limits>
+#include <span>
+
+namespace Utility {
+
+    template <std::unsigned_integral UInt>
+    struct CRCSpec {
+        UInt polynomial{};
+        UInt init{};
+        UInt xor_out{};
+        bool reflected{};
+    };
+
+    inline constexpr CRCSpec<std::uint8_t> CRC8_SMBUS{0x07U, 0x00U, 0x00U, false};
+    inline constexpr CRCSpec<std::uint8_t> CRC8_MAXIM{0x31U, 0x00U, 0x00U, true};
+    inline constexpr CRCSpec<std::uint16_t> CRC16_CCITT_FALSE{0x1021U, 0xFFFFU, 0x0000U, false};
+    inline constexpr CRCSpec<std::uint16_t> CRC16_XMODEM{0x1021U, 0x0000U, 0x0000U, false};
+    inline constexpr CRCSpec<std::uint16_t> CRC16_MODBUS{0x8005U, 0xFFFFU, 0x0000U, true};
+    inline constexpr CRCSpec<std::uint32_t> CRC32{0x04C11DB7UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, true};
+    inline constexpr CRCSpec<std::uint32_t> CRC32_MPEG2{0x04C11DB7UL, 0xFFFFFFFFUL, 0x00000000UL, false};
+
+    template <std::unsigned_integral UInt, CRCSpec<UInt> SPEC>
+    [[nodiscard]] constexpr UInt crc_byte_remainder(std::uint8_t const byte) noexcept
+    {
+        constexpr std::uint32_t width{std::numeric_limits<UInt>::digits};
+        if constexpr (SPEC.reflected) {
+            constexpr auto polynomial{reflection(SPEC.polynomial)};
+            auto crc{static_cast<UInt>(byte)};
+            for (std::uint8_t bit{}; bit < 8U; ++bit) {
+                crc = (crc & 1U) != 0U ? static_cast<UInt>((crc >> 1U) ^ polynomial) : static_cast<UInt>(crc >> 1U);
+            }
+            return crc;
+        } else {
+            constexpr auto msb{static_cast<UInt>(UInt{1U} << (width - 1U))};
+            auto crc{static_cast<UInt>(static_cast<UInt>(byte) << (width - 8U))};
+            for (std::uint8_t bit{}; bit < 8U; ++bit) {
+                crc = (crc & msb) != 0U ? static_cast<UInt>((crc << 1U) ^ SPEC.polynomial)
+                                        : static_cast<UInt>(crc << 1U);
+            }
+            return crc;
+        }
+    }
+
+    template <std::unsigned_integral UInt, CRCSpec<UInt> SPEC>
+    [[nodiscard]] constexpr UInt
+    crc_shift_byte(UInt const crc, std::uint8_t const byte, std::array<UInt, 256UL> const& table) noexcept
+    {
+        constexpr std::uint32_t width{std::numeric_limits<UInt>::digits};
+        if constexpr (SPEC.reflected) {
+            return static_cast<UInt>((static_cast<std::uint32_t>(crc) >> 8U) ^ table[(crc ^ byte) & 0xFFU]);
+        } else {
+            return static_cast<UInt>((static_cast<std::uint32_t>(crc) << 8U) ^
+                                     table[((crc >> (width - 8U)) ^ byte) & 0xFFU]);
+        }
+    }
+
+    template <std::unsigned_integral UInt, CRCSpec<UInt> SPEC, std::size_t SLICES>
+    [[nodiscard]] constexpr std::array<std::array<UInt, 256UL>, SLICES> make_crc_tables() noexcept
+    {
+        std::array<std::array<UInt, 256UL>, SLICES> tables{};
+        for (std::size_t index{}; index < 256UL; ++index) {
+            tables[0][index] = crc_byte_remainder<UInt, SPEC>(static_cast<std::uint8_t>(index));
+        }
+        for (std::size_t slice{1UL}; slice < SLICES; ++slice) {
+            for (std::size_t index{}; index < 256UL; ++index) {
+                tables[slice][index] = crc_shift_byte<UInt, SPEC>(tables[slice - 1UL][index], 0U, tables[0]);
+            }
+        }
+        return tables;
+    }
+
+    template <std::unsigned_integral UInt, CRCSpec<UInt> SPEC>
+        requires(std::numeric_limits<UInt>::digits >= 8 && std::numeric_limits<UInt>::digits <= 32)
+    struct CRCEngine {
+    public:
+        static constexpr std::uint32_t WIDTH{std::numeric_limits<UInt>::digits};
+        static constexpr std::size_t SLICES{4UL};
+
+        using Table = std::array<UInt, 256UL>;
+
+        static constexpr std::array<Table, SLICES> TABLES{make_crc_tables<UInt, SPEC, SLICES>()};
+
+        [[nodiscard]] static constexpr UInt calculate(std::span<std::uint8_t const> const data) noexcept
+        {
+            return finalize(update(initial(), data));
+        }
+
+        [[nodiscard]] static constexpr UInt initial() noexcept
+        {
+            return SPEC.reflected ? reflection(SPEC.init) : SPEC.init;
+        }
+
+        [[nodiscard]] static constexpr UInt finalize(UInt const crc) noexcept
+        {
+            return static_cast<UInt>(crc ^ SPEC.xor_out);
+        }
+
+        [[nodiscard]] static constexpr UInt update(UInt crc, std::span<std::uint8_t const> const data) noexcept
+        {
+            std::size_t index{};
+            for (; index + SLICES <= data.size(); index += SLICES) {
+                crc = update_slice(crc, data.subspan(index, SLICES));
+            }
+            for (; index < data.size(); ++index) {
+                crc = crc_shift_byte<UInt, SPEC>(crc, data[index], TABLES[0]);
+            }
+            return crc;
+        }
+
+        constexpr void reset() noexcept
+        {
+            this->crc_ = initial();
+        }
+
+        constexpr void update(std::span<std::uint8_t const> const data) noexcept
+        {
+            this->crc_ = update(this->crc_, data);
+        }
+
+        [[nodiscard]] constexpr UInt value() const noexcept
+        {
+            return finalize(this->crc_);
+        }
+
+    private:
+        [[nodiscard]] static constexpr UInt update_slice(UInt const crc,
+                                                         std::span<std::uint8_t const> const bytes) noexcept
+        {
+            if constexpr (SPEC.reflected) {
+                auto const word{(static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8U) |
+                                 (static_cast<std::uint32_t>(bytes[2]) << 16U) |
+                                 (static_cast<std::uint32_t>(bytes[3]) << 24U)) ^
+                                static_cast<std::uint32_t>(crc)};
+                return static_cast<UInt>(TABLES[3][word & 0xFFU] ^ TABLES[2][(word >> 8U) & 0xFFU] ^
+                                         TABLES[1][(word >> 16U) & 0xFFU] ^ TABLES[0][word >> 24U]);
+            } else {
+                auto const word{((static_cast<std::uint32_t>(bytes[0]) << 24U) |
+                                 (static_cast<std::uint32_t>(bytes[1]) << 16U) |
+                                 (static_cast<std::uint32_t>(bytes[2]) << 8U) | static_cast<std::uint32_t>(bytes[3])) ^
+                                (static_cast<std::uint32_t>(crc) << (32U - WIDTH))};
+                return static_cast<UInt>(TABLES[3][word >> 24U] ^ TABLES[2][(word >> 16U) & 0xFFU] ^
+                                         TABLES[1][(word >> 8U) & 0xFFU] ^ TABLES[0][word & 0xFFU]);
+            }
+        }
+
+        UInt crc_{initial()};
+    };
+
+    template <std::unsigned_integral UInt, CRCSpec<UInt> SPEC>
+    [[nodiscard]] constexpr UInt calculate_crc(std::span<std::uint8_t const> const data) noexcept
+    {
+        return CRCEngine<UInt, SPEC>::calculate(data);
+    }
+
+    inline constexpr std::array<std::uint8_t, 9UL> CRC_CHECK_INPUT{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    static_assert(calculate_crc<std::uint8_t, CRC8_SMBUS>(CRC_CHECK_INPUT) == 0xF4U);
+    static_assert(calculate_crc<std::uint8_t, CRC8_MAXIM>(CRC_CHECK_INPUT) == 0xA1U);
+    static_assert(calculate_crc<std::uint16_t, CRC16_CCITT_FALSE>(CRC_CHECK_INPUT) == 0x29B1U);
+    static_assert(calculate_crc<std::uint16_t, CRC16_XMODEM>(CRC_CHECK_INPUT) == 0x31C3U);
+    static_assert(calculate_crc<std::uint16_t, CRC16_MODBUS>(CRC_CHECK_INPUT) == 0x4B37U);
+    static_assert(calculate_crc<std::uint32_t, CRC32>(CRC_CHECK_INPUT) == 0xCBF43926UL);
+    static_assert(calculate_crc<std::uint32_t, CRC32_MPEG2>(CRC_CHECK_INPUT) == 0x0376E6E7UL);
+
+}; // namespace Utility
+
+#endif // CRC_HPP
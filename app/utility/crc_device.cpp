@@ -0,0 +1,128 @@
+#include "crc_device.hpp"
+
+namespace Utility {
+
+    namespace {
+
+        CRCDevice const* crc_owner{nullptr};
+
+    }; // namespace
+
+    CRCDevice::~CRCDevice() noexcept
+    {
+        if (crc_owner == this) {
+            crc_owner = nullptr;
+        }
+    }
+
+    void CRCDevice::reset() const noexcept
+    {
+        if (this->initialized_) {
+            crc_owner = this;
+            CRC->POL = this->polynomial_;
+            CRC->INIT = this->init_;
+            CRC->CR = this->control_bits() | CRC_CR_RESET;
+        }
+    }
+
+    void CRCDevice::update(std::span<std::uint8_t const> const data) const noexcept
+    {
+        if (!this->is_owner()) {
+            return;
+        }
+
+        // words are fed big-endian so the peripheral sees the bytes in stream order
+        std::size_t index{};
+        for (; index + sizeof(std::uint32_t) <= data.size(); index += sizeof(std::uint32_t)) {
+            std::uint32_t word{};
+            std::memcpy(&word, data.data() + index, sizeof(word));
+            CRC->DR = __REV(word);
+        }
+        for (; index < data.size(); ++index) {
+            *reinterpret_cast<std::uint8_t volatile*>(&CRC->DR) = data[index];
+        }
+    }
+
+    HAL_StatusTypeDef CRCDevice::update_dma(std::span<std::uint8_t const> const data) const noexcept
+    {
+        if (!this->is_owner() || this->dma_ == nullptr) {
+            return HAL_ERROR;
+        }
+
+        for (std::size_t offset{}; offset < data.size(); offset += MAX_DMA_TRANSFER) {
+            auto const chunk{data.subspan(offset, std::min(MAX_DMA_TRANSFER, data.size() - offset))};
+            if (HAL_DMA_Start(this->dma_,
+                              static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(chunk.data())),
+                              static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&CRC->DR)),
+                              static_cast<std::uint32_t>(chunk.size())) != HAL_OK) {
+                return HAL_ERROR;
+            }
+            if (auto const status{HAL_DMA_PollForTransfer(this->dma_, HAL_DMA_FULL_TRANSFER, DMA_TIMEOUT)};
+                status != HAL_OK) {
+                return status;
+            }
+        }
+        return HAL_OK;
+    }
+
+    std::uint32_t CRCDevice::value() const noexcept
+    {
+        if (!this->is_owner()) {
+            return 0UL;
+        }
+        return (CRC->DR ^ this->xor_out_) & this->width_mask();
+    }
+
+    std::uint32_t CRCDevice::calculate(std::span<std::uint8_t const> const data) const noexcept
+    {
+        this->reset();
+        this->update(data);
+        return this->value();
+    }
+
+    bool CRCDevice::is_initialized() const noexcept
+    {
+        return this->initialized_;
+    }
+
+    bool CRCDevice::is_owner() const noexcept
+    {
+        return this->initialized_ && crc_owner == this;
+    }
+
+    std::uint32_t CRCDevice::control_bits() const noexcept
+    {
+        auto control{this->reflected_ ? CRC_CR_REV_IN_0 | CRC_CR_REV_OUT : 0UL};
+        if (this->width_ == 16U) {
+            control |= CRC_CR_POLYSIZE_0;
+        } else if (this->width_ == 8U) {
+            control |= CRC_CR_POLYSIZE_1;
+        }
+        return control;
+    }
+
+    std::uint32_t CRCDevice::width_mask() const noexcept
+    {
+        return this->width_ >= 32U ? 0xFFFFFFFFUL : (1UL << this->width_) - 1UL;
+    }
+
+    void CRCDevice::initialize() noexcept
+    {
+        if (this->width_ != 8U && this->width_ != 16U && this->width_ != 32U) {
+            return;
+        }
+        // memory-to-memory DMA reads the source through the peripheral port and writes DR through the memory port
+        if (this->dma_ != nullptr &&
+            (this->dma_->Init.Direction != DMA_MEMORY_TO_MEMORY || this->dma_->Init.PeriphInc != DMA_PINC_ENABLE ||
+             this->dma_->Init.MemInc != DMA_MINC_DISABLE ||
+             this->dma_->Init.PeriphDataAlignment != DMA_PDATAALIGN_BYTE ||
+             this->dma_->Init.MemDataAlignment != DMA_MDATAALIGN_BYTE)) {
+            return;
+        }
+
+        __HAL_RCC_CRC_CLK_ENABLE();
+        this->initialized_ = true;
+        this->reset();
+    }
+
+}; // namespace Utility
@@ -0,0 +1,68 @@
+#ifndef CRC_DEVICE_HPP
+#define CRC_DEVICE_HPP
+
+#include "common.hpp"
+#include "crc.hpp"
+#include "utility.hpp"
+#include <span>
+
+namespace Utility {
+
+    // the CRC unit is a single peripheral: reset() claims it, and a device whose claim was taken over by another
+    // device's reset() ignores updates until it resets again
+    struct CRCDevice {
+    public:
+        CRCDevice() noexcept = default;
+
+        template <std::unsigned_integral UInt>
+        explicit CRCDevice(CRCSpec<UInt> const& spec, DMAHandle const dma = nullptr) noexcept :
+            dma_{dma},
+            polynomial_{spec.polynomial},
+            init_{spec.init},
+            xor_out_{spec.xor_out},
+            width_{std::numeric_limits<UInt>::digits},
+            reflected_{spec.reflected}
+        {
+            this->initialize();
+        }
+
+        CRCDevice(CRCDevice const& other) = delete;
+        CRCDevice(CRCDevice&& other) noexcept = delete;
+
+        CRCDevice& operator=(CRCDevice const& other) = delete;
+        CRCDevice& operator=(CRCDevice&& other) noexcept = delete;
+
+        ~CRCDevice() noexcept;
+
+        void reset() const noexcept;
+        void update(std::span<std::uint8_t const> const data) const noexcept;
+        HAL_StatusTypeDef update_dma(std::span<std::uint8_t const> const data) const noexcept;
+        [[nodiscard]] std::uint32_t value() const noexcept;
+
+        [[nodiscard]] std::uint32_t calculate(std::span<std::uint8_t const> const data) const noexcept;
+
+        [[nodiscard]] bool is_initialized() const noexcept;
+        [[nodiscard]] bool is_owner() const noexcept;
+
+    private:
+        static constexpr std::uint32_t DMA_TIMEOUT{100U};
+        static constexpr std::size_t MAX_DMA_TRANSFER{0xFFFFU};
+
+        std::uint32_t control_bits() const noexcept;
+        std::uint32_t width_mask() const noexcept;
+
+        void initialize() noexcept;
+
+        bool initialized_{false};
+
+        DMAHandle dma_{nullptr};
+        std::uint32_t polynomial_{};
+        std::uint32_t init_{};
+        std::uint32_t xor_out_{};
+        std::uint32_t width_{};
+        bool reflected_{};
+    };
+
+}; // namespace Utility
+
+#endif // CRC_DEVICE_HPP
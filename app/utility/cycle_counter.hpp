@@ -0,0 +1,60 @@
+#ifndef CYCLE_COUNTER_HPP
+#define CYCLE_COUNTER_HPP
+
+#include "common.hpp"
+#include "utility.hpp"
+
+namespace Utility {
+
+    inline void cycle_counter_enable() noexcept
+    {
+        if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0UL) {
+            CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+            DWT->CYCCNT = 0UL;
+            DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+        }
+    }
+
+    [[nodiscard]] inline std::uint32_t cycle_counter_get() noexcept
+    {
+        return DWT->CYCCNT;
+    }
+
+    [[nodiscard]] inline std::uint32_t cycles_per_microsecond() noexcept
+    {
+        return SystemCoreClock / 1000000UL;
+    }
+
+    [[nodiscard]] inline std::uint32_t cycles_to_microseconds(std::uint32_t const cycles) noexcept
+    {
+        return cycles / cycles_per_microsecond();
+    }
+
+    [[nodiscard]] inline std::uint32_t cycle_counter_elapsed(std::uint32_t const start_cycles) noexcept
+    {
+        return cycle_counter_get() - start_cycles;
+    }
+
+    template <typename Function>
+    [[nodiscard]] inline std::uint32_t cycle_counter_measure(Function&& function) noexcept
+    {
+        auto const start_cycles{cycle_counter_get()};
+        std::forward<Function>(function)();
+        return cycle_counter_elapsed(start_cycles);
+    }
+
+    inline void cycle_counter_delay_cycles(std::uint32_t const cycles) noexcept
+    {
+        auto const start_cycles{cycle_counter_get()};
+        while (cycle_counter_elapsed(start_cycles) < cycles) {
+        }
+    }
+
+    inline void cycle_counter_delay_microseconds(std::uint32_t const microseconds) noexcept
+    {
+        cycle_counter_delay_cycles(microseconds * cycles_per_microsecond());
+    }
+
+}; // namespace Utility
+
+#endif // CYCLE_COUNTER_HPP
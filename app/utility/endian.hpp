@@ -0,0 +1,113 @@
+#ifndef ENDIAN_HPP
+#define ENDIAN_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#if defined(__ARM_ARCH)
+#include "cmsis_compiler.h"
+#endif
+
+namespace Utility {
+
+    template <typename T>
+    concept EndianInteger = std::unsigned_integral<T> && (sizeof(T) == 2UL || sizeof(T) == 4UL || sizeof(T) == 8UL);
+
+    template <EndianInteger UInt>
+    [[nodiscard]] constexpr UInt byte_swap(UInt const value) noexcept
+    {
+        if consteval {
+            return std::byteswap(value);
+        } else {
+#if defined(__ARM_ARCH)
+            if constexpr (sizeof(UInt) == 2UL) {
+                return static_cast<UInt>(__REV16(value));
+            } else if constexpr (sizeof(UInt) == 4UL) {
+                return static_cast<UInt>(__REV(value));
+            }
+#endif
+            return std::byteswap(value);
+        }
+    }
+
+    template <EndianInteger UInt>
+    [[nodiscard]] constexpr UInt native_to_endian(UInt const value, std::endian const endian) noexcept
+    {
+        return endian == std::endian::native ? value : byte_swap(value);
+    }
+
+    template <EndianInteger UInt>
+    [[nodiscard]] constexpr UInt endian_to_native(UInt const value, std::endian const endian) noexcept
+    {
+        return endian == std::endian::native ? value : byte_swap(value);
+    }
+
+    template <EndianInteger UInt>
+    constexpr void byte_swap_in_place(std::span<UInt> const values) noexcept
+    {
+        for (auto& value : values) {
+            value = byte_swap(value);
+        }
+    }
+
+    template <EndianInteger UInt>
+    constexpr void
+    convert_endian_in_place(std::span<UInt> const values, std::endian const from, std::endian const to) noexcept
+    {
+        if (from != to) {
+            byte_swap_in_place(values);
+        }
+    }
+
+    template <EndianInteger UInt>
+    constexpr std::size_t load_endian(std::span<std::uint8_t const> const bytes,
+                                      std::span<UInt> const values,
+                                      std::endian const endian) noexcept
+    {
+        auto const count{std::min(bytes.size() / sizeof(UInt), values.size())};
+        if consteval {
+            for (std::size_t index{}; index < count; ++index) {
+                UInt value{};
+                for (std::size_t byte{}; byte < sizeof(UInt); ++byte) {
+                    auto const shift{endian == std::endian::little ? 8UL * byte : 8UL * (sizeof(UInt) - 1UL - byte)};
+                    value = static_cast<UInt>(value | (static_cast<UInt>(bytes[index * sizeof(UInt) + byte]) << shift));
+                }
+                values[index] = value;
+            }
+        } else {
+            for (std::size_t index{}; index < count; ++index) {
+                UInt value{};
+                std::memcpy(&value, bytes.data() + index * sizeof(UInt), sizeof(UInt));
+                values[index] = endian_to_native(value, endian);
+            }
+        }
+        return count;
+    }
+
+    template <EndianInteger UInt>
+    constexpr std::size_t store_endian(std::span<UInt const> const values,
+                                       std::span<std::uint8_t> const bytes,
+                                       std::endian const endian) noexcept
+    {
+        auto const count{std::min(bytes.size() / sizeof(UInt), values.size())};
+        for (std::size_t index{}; index < count; ++index) {
+            if consteval {
+                for (std::size_t byte{}; byte < sizeof(UInt); ++byte) {
+                    auto const shift{endian == std::endian::little ? 8UL * byte : 8UL * (sizeof(UInt) - 1UL - byte)};
+                    bytes[index * sizeof(UInt) + byte] = static_cast<std::uint8_t>(values[index] >> shift);
+                }
+            } else {
+                auto const value{native_to_endian(values[index], endian)};
+                std::memcpy(bytes.data() + index * sizeof(UInt), &value, sizeof(UInt));
+            }
+        }
+        return count;
+    }
+
+}; // namespace Utility
+
+#endif // ENDIAN_HPP
@@ -144,46 +144,180 @@ namespace Utility {
         PH15,
     };
 
-    namespace {
+    inline constexpr auto GPIO_PORT_BASES = std::array<std::uintptr_t, 8UL>{
+        GPIOA_BASE, GPIOB_BASE, GPIOC_BASE, GPIOD_BASE, GPIOE_BASE, GPIOF_BASE, GPIOG_BASE, GPIOH_BASE};
 
-        [[nodiscard]] GPIO_TypeDef* pin_to_port(GPIO const pin) noexcept
-        {
-            static auto constexpr GPIO_PORTS = std::array{GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG, GPIOH};
-            return GPIO_PORTS[std::to_underlying(pin) / 16U];
-        }
+    [[nodiscard]] constexpr std::size_t pin_to_port_index(GPIO const pin) noexcept
+    {
+        return std::to_underlying(pin) / 16U;
+    }
 
-        [[nodiscard]] inline std::uint16_t pin_to_mask(GPIO const pin) noexcept
-        {
-            return 1U << (std::to_underlying(pin) % 16U);
+    [[nodiscard]] constexpr std::uintptr_t pin_to_port_base(GPIO const pin) noexcept
+    {
+        return GPIO_PORT_BASES[pin_to_port_index(pin)];
+    }
+
+    [[nodiscard]] constexpr std::uint16_t pin_to_mask(GPIO const pin) noexcept
+    {
+        return static_cast<std::uint16_t>(1U << (std::to_underlying(pin) % 16U));
+    }
+
+    [[nodiscard]] inline GPIO_TypeDef* port_index_to_port(std::size_t const port_index) noexcept
+    {
+        return reinterpret_cast<GPIO_TypeDef*>(GPIO_PORT_BASES[port_index]);
+    }
+
+    [[nodiscard]] inline GPIO_TypeDef* pin_to_port(GPIO const pin) noexcept
+    {
+        return reinterpret_cast<GPIO_TypeDef*>(pin_to_port_base(pin));
+    }
+
+    inline void gpio_enable_port_clock(GPIO_TypeDef const* const port) noexcept
+    {
+        for (std::size_t port_index{}; port_index < GPIO_PORT_BASES.size(); ++port_index) {
+            if (reinterpret_cast<std::uintptr_t>(port) == GPIO_PORT_BASES[port_index]) {
+                // GPIOAEN..GPIOHEN are consecutive AHB2ENR bits, read back so the clock is running on return
+                RCC->AHB2ENR = RCC->AHB2ENR | (RCC_AHB2ENR_GPIOAEN << port_index);
+                static_cast<void>(RCC->AHB2ENR);
+                return;
+            }
         }
+    }
 
-    }; // namespace
+    inline void gpio_write_mask(GPIO_TypeDef* const port,
+                                std::uint16_t const set_mask,
+                                std::uint16_t const reset_mask) noexcept
+    {
+        port->BSRR = (static_cast<std::uint32_t>(reset_mask) << 16U) | set_mask;
+    }
 
     [[nodiscard]] inline GPIO_PinState gpio_read_pin(GPIO const pin) noexcept
     {
-        return HAL_GPIO_ReadPin(pin_to_port(pin), pin_to_mask(pin));
+        return (pin_to_port(pin)->IDR & pin_to_mask(pin)) != 0UL ? GPIO_PIN_SET : GPIO_PIN_RESET;
     }
 
     inline void gpio_write_pin(GPIO const pin, GPIO_PinState const gpio_state) noexcept
     {
-        HAL_GPIO_WritePin(pin_to_port(pin), pin_to_mask(pin), gpio_state);
+        if (gpio_state == GPIO_PIN_SET) {
+            gpio_write_mask(pin_to_port(pin), pin_to_mask(pin), 0U);
+        } else {
+            gpio_write_mask(pin_to_port(pin), 0U, pin_to_mask(pin));
+        }
     }
 
     inline void gpio_toggle_pin(GPIO const pin) noexcept
     {
-        HAL_GPIO_TogglePin(pin_to_port(pin), pin_to_mask(pin));
+        auto* const port{pin_to_port(pin)};
+        auto const mask{pin_to_mask(pin)};
+        auto const output{port->ODR};
+        gpio_write_mask(port, static_cast<std::uint16_t>(~output & mask), static_cast<std::uint16_t>(output & mask));
     }
 
     inline void gpio_set_pin(GPIO const pin) noexcept
     {
-        HAL_GPIO_WritePin(pin_to_port(pin), pin_to_mask(pin), GPIO_PIN_SET);
+        gpio_write_mask(pin_to_port(pin), pin_to_mask(pin), 0U);
     }
 
     inline void gpio_reset_pin(GPIO const pin) noexcept
     {
-        HAL_GPIO_WritePin(pin_to_port(pin), pin_to_mask(pin), GPIO_PIN_RESET);
+        gpio_write_mask(pin_to_port(pin), 0U, pin_to_mask(pin));
     }
 
+    template <GPIO... PINS>
+    struct GpioGroup {
+    public:
+        static constexpr std::size_t SIZE{sizeof...(PINS)};
+        static constexpr std::size_t PORT_COUNT{GPIO_PORT_BASES.size()};
+
+        static_assert(SIZE > 0UL && SIZE <= 32UL);
+
+        using PortMasks = std::array<std::uint16_t, PORT_COUNT>;
+
+        static void set() noexcept
+        {
+            store(PORT_MASKS, PortMasks{});
+        }
+
+        static void reset() noexcept
+        {
+            store(PortMasks{}, PORT_MASKS);
+        }
+
+        static void write(std::uint32_t const value) noexcept
+        {
+            PortMasks set_masks{};
+            for (std::size_t index{}; index < SIZE; ++index) {
+                if ((value & (1UL << index)) != 0UL) {
+                    set_masks[pin_to_port_index(PIN_LIST[index])] |= pin_to_mask(PIN_LIST[index]);
+                }
+            }
+
+            PortMasks reset_masks{};
+            for (std::size_t port_index{}; port_index < PORT_COUNT; ++port_index) {
+                reset_masks[port_index] = static_cast<std::uint16_t>(PORT_MASKS[port_index] & ~set_masks[port_index]);
+            }
+            store(set_masks, reset_masks);
+        }
+
+        static void toggle() noexcept
+        {
+            PortMasks set_masks{};
+            PortMasks reset_masks{};
+            for (std::size_t port_index{}; port_index < PORT_COUNT; ++port_index) {
+                if (PORT_MASKS[port_index] != 0U) {
+                    auto const output{port_index_to_port(port_index)->ODR};
+                    set_masks[port_index] = static_cast<std::uint16_t>(~output & PORT_MASKS[port_index]);
+                    reset_masks[port_index] = static_cast<std::uint16_t>(output & PORT_MASKS[port_index]);
+                }
+            }
+            store(set_masks, reset_masks);
+        }
+
+        [[nodiscard]] static std::uint32_t read() noexcept
+        {
+            std::array<std::uint32_t, PORT_COUNT> inputs{};
+            for (std::size_t port_index{}; port_index < PORT_COUNT; ++port_index) {
+                if (PORT_MASKS[port_index] != 0U) {
+                    inputs[port_index] = port_index_to_port(port_index)->IDR;
+                }
+            }
+
+            std::uint32_t value{};
+            for (std::size_t index{}; index < SIZE; ++index) {
+                if ((inputs[pin_to_port_index(PIN_LIST[index])] & pin_to_mask(PIN_LIST[index])) != 0UL) {
+                    value |= 1UL << index;
+                }
+            }
+            return value;
+        }
+
+    private:
+        static constexpr std::array<GPIO, SIZE> PIN_LIST{PINS...};
+
+        static constexpr PortMasks PORT_MASKS = [] {
+            PortMasks port_masks{};
+            for (auto const pin : PIN_LIST) {
+                port_masks[pin_to_port_index(pin)] |= pin_to_mask(pin);
+            }
+            return port_masks;
+        }();
+
+        static void store(PortMasks const& set_masks, PortMasks const& reset_masks) noexcept
+        {
+            [&]<std::size_t... PORT_INDICES>(std::index_sequence<PORT_INDICES...>) {
+                (store_port<PORT_INDICES>(set_masks[PORT_INDICES], reset_masks[PORT_INDICES]), ...);
+            }(std::make_index_sequence<PORT_COUNT>{});
+        }
+
+        template <std::size_t PORT_INDEX>
+        static void store_port(std::uint16_t const set_mask, std::uint16_t const reset_mask) noexcept
+        {
+            if constexpr (PORT_MASKS[PORT_INDEX] != 0U) {
+                gpio_write_mask(port_index_to_port(PORT_INDEX), set_mask, reset_mask);
+            }
+        }
+    };
+
 }; // namespace Utility
 
 #endif // GPIO_HPP
\ No newline at end of file
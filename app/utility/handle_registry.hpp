@@ -0,0 +1,65 @@
+#ifndef HANDLE_REGISTRY_HPP
+#define HANDLE_REGISTRY_HPP
+
+#include "utility.hpp"
+
+namespace Utility {
+
+    template <typename Handle, typename Object, std::size_t SIZE>
+    struct HandleRegistry {
+    public:
+        bool insert(Handle const handle, Object* const object) noexcept
+        {
+            auto* entry{this->find_entry(handle)};
+            if (entry == nullptr) {
+                entry = this->find_entry(nullptr);
+            }
+            if (entry == nullptr) {
+                return false;
+            }
+            entry->handle = handle;
+            entry->object = object;
+            return true;
+        }
+
+        void erase(Handle const handle) noexcept
+        {
+            for (auto& entry : this->entries_) {
+                if (entry.handle == handle) {
+                    entry = Entry{};
+                }
+            }
+        }
+
+        [[nodiscard]] Object* find(Handle const handle) const noexcept
+        {
+            for (auto const& entry : this->entries_) {
+                if (entry.handle == handle) {
+                    return entry.object;
+                }
+            }
+            return nullptr;
+        }
+
+    private:
+        struct Entry {
+            Handle handle{nullptr};
+            Object* object{nullptr};
+        };
+
+        Entry* find_entry(Handle const handle) noexcept
+        {
+            for (auto& entry : this->entries_) {
+                if (entry.handle == handle) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        std::array<Entry, SIZE> entries_{};
+    };
+
+}; // namespace Utility
+
+#endif // HANDLE_REGISTRY_HPP
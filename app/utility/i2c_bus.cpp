@@ -0,0 +1,366 @@
+#include "i2c_bus.hpp"
+#include "cycle_counter.hpp"
+#include "handle_registry.hpp"
+
+namespace Utility {
+
+    namespace {
+
+        HandleRegistry<I2CHandle, I2CBus, 3U> i2c_bus_registry{};
+
+    }; // namespace
+
+    I2CBus::I2CBus(I2CHandle const i2c_bus, GPIO const scl_pin, GPIO const sda_pin) noexcept :
+        i2c_bus_{i2c_bus}, scl_pin_{scl_pin}, sda_pin_{sda_pin}
+    {
+        cycle_counter_enable();
+    }
+
+    bool I2CBus::is_stuck() const noexcept
+    {
+        if (this->i2c_bus_ == nullptr) {
+            return false;
+        }
+        return __HAL_I2C_GET_FLAG(this->i2c_bus_, I2C_FLAG_BUSY) == SET ||
+               gpio_read_pin(this->sda_pin_) == GPIO_PIN_RESET;
+    }
+
+    bool I2CBus::recover() noexcept
+    {
+        if (this->i2c_bus_ == nullptr) {
+            return false;
+        }
+
+        auto const start_cycles{cycle_counter_get()};
+
+        HAL_I2C_DeInit(this->i2c_bus_);
+        this->configure_pins_as_gpio();
+
+        gpio_write_pin(this->sda_pin_, GPIO_PIN_SET);
+        gpio_write_pin(this->scl_pin_, GPIO_PIN_SET);
+        cycle_counter_delay_microseconds(HALF_PERIOD_US);
+
+        for (std::uint32_t pulse{}; pulse < RECOVERY_CLOCK_PULSES; ++pulse) {
+            if (gpio_read_pin(this->sda_pin_) == GPIO_PIN_SET) {
+                break;
+            }
+            this->clock_pulse();
+            ++this->recovery_stats_.clock_pulse_count;
+        }
+        this->generate_stop();
+
+        auto const released{gpio_read_pin(this->sda_pin_) == GPIO_PIN_SET &&
+                            gpio_read_pin(this->scl_pin_) == GPIO_PIN_SET};
+        auto const reinitialized{HAL_I2C_Init(this->i2c_bus_) == HAL_OK};
+
+        auto const recovery_us{cycles_to_microseconds(cycle_counter_elapsed(start_cycles))};
+        this->recovery_stats_.last_recovery_us = recovery_us;
+        this->recovery_stats_.max_recovery_us = std::max(this->recovery_stats_.max_recovery_us, recovery_us);
+
+        if (released && reinitialized) {
+            ++this->recovery_stats_.recovery_count;
+            return true;
+        }
+        ++this->recovery_stats_.failed_recovery_count;
+        return false;
+    }
+
+    void I2CBus::scan() noexcept
+    {
+        if (this->i2c_bus_ == nullptr) {
+            return;
+        }
+        if (this->is_stuck()) {
+            this->recover();
+        }
+
+        this->present_devices_.reset();
+        for (auto dev_address{SCAN_FIRST_ADDRESS}; dev_address <= SCAN_LAST_ADDRESS; ++dev_address) {
+            if (HAL_I2C_IsDeviceReady(this->i2c_bus_, dev_address << 1, SCAN_TRIALS, SCAN_TIMEOUT) == HAL_OK) {
+                this->present_devices_.set(dev_address);
+            }
+        }
+        this->scanned_ = true;
+    }
+
+    bool I2CBus::is_scanned() const noexcept
+    {
+        return this->scanned_;
+    }
+
+    bool I2CBus::is_device_present(std::uint16_t const dev_address) const noexcept
+    {
+        if (dev_address > SCAN_LAST_ADDRESS) {
+            return false;
+        }
+        return this->present_devices_.test(dev_address);
+    }
+
+    std::size_t I2CBus::device_count() const noexcept
+    {
+        return this->present_devices_.count();
+    }
+
+    bool I2CBus::start_sequence(std::span<I2CTransfer const> const transfers) noexcept
+    {
+        if (this->i2c_bus_ == nullptr || this->sequence_busy_ || transfers.empty()) {
+            return false;
+        }
+
+        std::size_t frame_count{};
+        for (auto const& transfer : transfers) {
+            if (transfer.direction == I2CTransfer::Direction::READ) {
+                if (transfer.data.empty() || transfer.data.size() > MAX_READ_SIZE) {
+                    return false;
+                }
+                frame_count += 2U;
+            } else {
+                if (transfer.data.size() > MAX_WRITE_SIZE) {
+                    return false;
+                }
+                frame_count += 1U;
+            }
+        }
+
+        if (!i2c_bus_registry.insert(this->i2c_bus_, this)) {
+            return false;
+        }
+
+        this->sequence_ = transfers;
+        this->transfer_index_ = 0U;
+        this->frame_index_ = 0U;
+        this->frame_count_ = frame_count;
+        this->phase_ = Phase::REGISTER;
+        this->sequence_status_ = HAL_BUSY;
+        this->sequence_busy_ = true;
+
+        if (this->start_frame() != HAL_OK) {
+            this->finish_sequence(HAL_ERROR);
+            return false;
+        }
+        return true;
+    }
+
+    HAL_StatusTypeDef I2CBus::run_sequence(std::span<I2CTransfer const> const transfers) noexcept
+    {
+        for (std::uint32_t replay{}; replay <= MAX_REPLAYS; ++replay) {
+            if (!this->start_sequence(transfers)) {
+                return HAL_ERROR;
+            }
+
+            auto const start_tick{HAL_GetTick()};
+            while (this->sequence_busy_) {
+                if (HAL_GetTick() - start_tick > SEQUENCE_TIMEOUT) {
+                    HAL_I2C_Master_Abort_IT(this->i2c_bus_, this->sequence_[this->transfer_index_].dev_address << 1);
+                    this->finish_sequence(HAL_TIMEOUT);
+                }
+            }
+
+            if (this->sequence_status_ == HAL_OK || !this->is_stuck() || !this->recover()) {
+                break;
+            }
+            ++this->recovery_stats_.replayed_count;
+        }
+        return this->sequence_status_;
+    }
+
+    void I2CBus::abort_sequence(HAL_StatusTypeDef const status) noexcept
+    {
+        if (!this->sequence_busy_) {
+            return;
+        }
+
+        HAL_I2C_Master_Abort_IT(this->i2c_bus_, this->sequence_[this->transfer_index_].dev_address << 1);
+        this->finish_sequence(status);
+        if (this->is_stuck()) {
+            this->recover();
+        }
+    }
+
+    bool I2CBus::is_sequence_busy() const noexcept
+    {
+        return this->sequence_busy_;
+    }
+
+    HAL_StatusTypeDef I2CBus::sequence_status() const noexcept
+    {
+        return this->sequence_status_;
+    }
+
+    void I2CBus::transmit_complete_callback() noexcept
+    {
+        this->advance_sequence();
+    }
+
+    void I2CBus::receive_complete_callback() noexcept
+    {
+        this->advance_sequence();
+    }
+
+    void I2CBus::error_callback() noexcept
+    {
+        if (this->sequence_busy_) {
+            this->finish_sequence(HAL_ERROR);
+        }
+    }
+
+    I2CBus::RecoveryStats const& I2CBus::recovery_stats() const noexcept
+    {
+        return this->recovery_stats_;
+    }
+
+    I2CHandle I2CBus::i2c_bus() const noexcept
+    {
+        return this->i2c_bus_;
+    }
+
+    HAL_StatusTypeDef I2CBus::start_frame() noexcept
+    {
+        auto const& transfer{this->sequence_[this->transfer_index_]};
+        auto const dev_address{static_cast<std::uint16_t>(transfer.dev_address << 1)};
+
+        if (this->phase_ == Phase::DATA) {
+            if (this->i2c_bus_->hdmarx != nullptr) {
+                return HAL_I2C_Master_Seq_Receive_DMA(this->i2c_bus_,
+                                                      dev_address,
+                                                      transfer.data.data(),
+                                                      static_cast<std::uint16_t>(transfer.data.size()),
+                                                      this->frame_options());
+            }
+            return HAL_I2C_Master_Seq_Receive_IT(this->i2c_bus_,
+                                                 dev_address,
+                                                 transfer.data.data(),
+                                                 static_cast<std::uint16_t>(transfer.data.size()),
+                                                 this->frame_options());
+        }
+
+        std::size_t frame_size{1U};
+        this->frame_buffer_[0] = transfer.reg_address;
+        if (transfer.direction == I2CTransfer::Direction::WRITE) {
+            std::memcpy(this->frame_buffer_.data() + 1U, transfer.data.data(), transfer.data.size());
+            frame_size += transfer.data.size();
+        }
+        if (this->i2c_bus_->hdmatx != nullptr) {
+            return HAL_I2C_Master_Seq_Transmit_DMA(this->i2c_bus_,
+                                                   dev_address,
+                                                   this->frame_buffer_.data(),
+                                                   static_cast<std::uint16_t>(frame_size),
+                                                   this->frame_options());
+        }
+        return HAL_I2C_Master_Seq_Transmit_IT(this->i2c_bus_,
+                                              dev_address,
+                                              this->frame_buffer_.data(),
+                                              static_cast<std::uint16_t>(frame_size),
+                                              this->frame_options());
+    }
+
+    std::uint32_t I2CBus::frame_options() const noexcept
+    {
+        auto const first_frame{this->frame_index_ == 0U};
+        auto const last_frame{this->frame_index_ + 1U == this->frame_count_};
+        if (first_frame) {
+            return last_frame ? I2C_FIRST_AND_LAST_FRAME : I2C_FIRST_FRAME;
+        }
+        return last_frame ? I2C_OTHER_AND_LAST_FRAME : I2C_OTHER_FRAME;
+    }
+
+    void I2CBus::advance_sequence() noexcept
+    {
+        if (!this->sequence_busy_) {
+            return;
+        }
+
+        ++this->frame_index_;
+        if (this->phase_ == Phase::REGISTER &&
+            this->sequence_[this->transfer_index_].direction == I2CTransfer::Direction::READ) {
+            this->phase_ = Phase::DATA;
+        } else {
+            ++this->transfer_index_;
+            this->phase_ = Phase::REGISTER;
+        }
+
+        if (this->transfer_index_ == this->sequence_.size()) {
+            this->finish_sequence(HAL_OK);
+        } else if (this->start_frame() != HAL_OK) {
+            this->finish_sequence(HAL_ERROR);
+        }
+    }
+
+    void I2CBus::finish_sequence(HAL_StatusTypeDef const status) noexcept
+    {
+        i2c_bus_registry.erase(this->i2c_bus_);
+        this->sequence_status_ = status;
+        this->sequence_busy_ = false;
+    }
+
+    void I2CBus::configure_pins_as_gpio() const noexcept
+    {
+        for (auto const pin : {this->scl_pin_, this->sda_pin_}) {
+            GPIO_InitTypeDef gpio_init{};
+            gpio_init.Pin = pin_to_mask(pin);
+            gpio_init.Mode = GPIO_MODE_OUTPUT_OD;
+            gpio_init.Pull = GPIO_NOPULL;
+            gpio_init.Speed = GPIO_SPEED_FREQ_HIGH;
+            HAL_GPIO_Init(pin_to_port(pin), &gpio_init);
+        }
+    }
+
+    bool I2CBus::wait_scl_released() const noexcept
+    {
+        auto const start_cycles{cycle_counter_get()};
+        auto const timeout_cycles{CLOCK_STRETCH_TIMEOUT_US * cycles_per_microsecond()};
+        while (gpio_read_pin(this->scl_pin_) == GPIO_PIN_RESET) {
+            if (cycle_counter_elapsed(start_cycles) > timeout_cycles) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void I2CBus::clock_pulse() const noexcept
+    {
+        gpio_write_pin(this->scl_pin_, GPIO_PIN_RESET);
+        cycle_counter_delay_microseconds(HALF_PERIOD_US);
+        gpio_write_pin(this->scl_pin_, GPIO_PIN_SET);
+        this->wait_scl_released();
+        cycle_counter_delay_microseconds(HALF_PERIOD_US);
+    }
+
+    void I2CBus::generate_stop() const noexcept
+    {
+        gpio_write_pin(this->scl_pin_, GPIO_PIN_RESET);
+        cycle_counter_delay_microseconds(HALF_PERIOD_US);
+        gpio_write_pin(this->sda_pin_, GPIO_PIN_RESET);
+        cycle_counter_delay_microseconds(HALF_PERIOD_US);
+        gpio_write_pin(this->scl_pin_, GPIO_PIN_SET);
+        this->wait_scl_released();
+        cycle_counter_delay_microseconds(HALF_PERIOD_US);
+        gpio_write_pin(this->sda_pin_, GPIO_PIN_SET);
+        cycle_counter_delay_microseconds(HALF_PERIOD_US);
+    }
+
+}; // namespace Utility
+
+extern "C" {
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    if (auto* const i2c_bus{Utility::i2c_bus_registry.find(hi2c)}; i2c_bus != nullptr) {
+        i2c_bus->transmit_complete_callback();
+    }
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef* hi2c)
+{
+    if (auto* const i2c_bus{Utility::i2c_bus_registry.find(hi2c)}; i2c_bus != nullptr) {
+        i2c_bus->receive_complete_callback();
+    }
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* hi2c)
+{
+    if (auto* const i2c_bus{Utility::i2c_bus_registry.find(hi2c)}; i2c_bus != nullptr) {
+        i2c_bus->error_callback();
+    }
+}
+}
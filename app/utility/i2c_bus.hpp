@@ -0,0 +1,136 @@
+#ifndef I2C_BUS_HPP
+#define I2C_BUS_HPP
+
+#include "common.hpp"
+#include "gpio.hpp"
+#include "utility.hpp"
+#include <span>
+
+namespace Utility {
+
+    struct I2CTransfer {
+        enum struct Direction : std::uint8_t {
+            READ,
+            WRITE,
+        };
+
+        Direction direction{};
+        std::uint16_t dev_address{};
+        std::uint8_t reg_address{};
+        std::span<std::uint8_t> data{};
+    };
+
+    struct I2CBus {
+    public:
+        struct RecoveryStats {
+            std::uint32_t recovery_count{};
+            std::uint32_t failed_recovery_count{};
+            std::uint32_t replayed_count{};
+            std::uint32_t clock_pulse_count{};
+            std::uint32_t last_recovery_us{};
+            std::uint32_t max_recovery_us{};
+        };
+
+        I2CBus() noexcept = default;
+        I2CBus(I2CHandle const i2c_bus, GPIO const scl_pin, GPIO const sda_pin) noexcept;
+
+        I2CBus(I2CBus const& other) = delete;
+        I2CBus(I2CBus&& other) noexcept = delete;
+
+        I2CBus& operator=(I2CBus const& other) = delete;
+        I2CBus& operator=(I2CBus&& other) noexcept = delete;
+
+        ~I2CBus() noexcept = default;
+
+        template <typename Transaction>
+        HAL_StatusTypeDef execute(Transaction&& transaction) noexcept;
+
+        [[nodiscard]] bool is_stuck() const noexcept;
+        bool recover() noexcept;
+
+        void scan() noexcept;
+        [[nodiscard]] bool is_scanned() const noexcept;
+        [[nodiscard]] bool is_device_present(std::uint16_t const dev_address) const noexcept;
+        [[nodiscard]] std::size_t device_count() const noexcept;
+
+        bool start_sequence(std::span<I2CTransfer const> const transfers) noexcept;
+        HAL_StatusTypeDef run_sequence(std::span<I2CTransfer const> const transfers) noexcept;
+        void abort_sequence(HAL_StatusTypeDef const status) noexcept;
+        [[nodiscard]] bool is_sequence_busy() const noexcept;
+        [[nodiscard]] HAL_StatusTypeDef sequence_status() const noexcept;
+
+        void transmit_complete_callback() noexcept;
+        void receive_complete_callback() noexcept;
+        void error_callback() noexcept;
+
+        [[nodiscard]] RecoveryStats const& recovery_stats() const noexcept;
+        [[nodiscard]] I2CHandle i2c_bus() const noexcept;
+
+    private:
+        static constexpr std::uint32_t MAX_REPLAYS{1U};
+        static constexpr std::uint32_t RECOVERY_CLOCK_PULSES{9U};
+        static constexpr std::uint32_t HALF_PERIOD_US{5U};
+        static constexpr std::uint32_t CLOCK_STRETCH_TIMEOUT_US{1000U};
+
+        static constexpr std::uint16_t SCAN_FIRST_ADDRESS{0x08U};
+        static constexpr std::uint16_t SCAN_LAST_ADDRESS{0x77U};
+        static constexpr std::uint32_t SCAN_TRIALS{1U};
+        static constexpr std::uint32_t SCAN_TIMEOUT{1U};
+
+        static constexpr std::size_t MAX_WRITE_SIZE{32U};
+        static constexpr std::size_t MAX_READ_SIZE{0xFFFFU};
+        static constexpr std::uint32_t SEQUENCE_TIMEOUT{100U};
+
+        enum struct Phase : std::uint8_t {
+            REGISTER,
+            DATA,
+        };
+
+        HAL_StatusTypeDef start_frame() noexcept;
+        std::uint32_t frame_options() const noexcept;
+        void advance_sequence() noexcept;
+        void finish_sequence(HAL_StatusTypeDef const status) noexcept;
+
+        void configure_pins_as_gpio() const noexcept;
+        bool wait_scl_released() const noexcept;
+        void clock_pulse() const noexcept;
+        void generate_stop() const noexcept;
+
+        I2CHandle i2c_bus_{nullptr};
+
+        GPIO scl_pin_{};
+        GPIO sda_pin_{};
+
+        RecoveryStats recovery_stats_{};
+
+        bool scanned_{false};
+        std::bitset<SCAN_LAST_ADDRESS + 1U> present_devices_{};
+
+        std::span<I2CTransfer const> sequence_{};
+        std::size_t transfer_index_{};
+        std::size_t frame_index_{};
+        std::size_t frame_count_{};
+        Phase phase_{};
+        std::array<std::uint8_t, 1U + MAX_WRITE_SIZE> frame_buffer_{};
+
+        bool volatile sequence_busy_{false};
+        HAL_StatusTypeDef volatile sequence_status_{HAL_OK};
+    };
+
+    template <typename Transaction>
+    HAL_StatusTypeDef I2CBus::execute(Transaction&& transaction) noexcept
+    {
+        auto status{transaction()};
+        for (std::uint32_t replay{}; status != HAL_OK && replay < MAX_REPLAYS && this->is_stuck(); ++replay) {
+            if (!this->recover()) {
+                break;
+            }
+            ++this->recovery_stats_.replayed_count;
+            status = transaction();
+        }
+        return status;
+    }
+
+}; // namespace Utility
+
+#endif // I2C_BUS_HPP
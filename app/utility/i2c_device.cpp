@@ -8,6 +8,12 @@ namespace Utility {
         this->initialize();
     }
 
+    I2CDevice::I2CDevice(I2CBus& i2c_bus, std::uint16_t const dev_address) noexcept :
+        i2c_bus_{i2c_bus.i2c_bus()}, bus_{&i2c_bus}, dev_address_{dev_address}
+    {
+        this->initialize();
+    }
+
     void I2CDevice::transmit_dword(std::uint32_t const dword) const noexcept
     {
         this->transmit_dwords(std::array<std::uint32_t, 1UL>{dword});
@@ -68,15 +74,43 @@ namespace Utility {
         this->write_bytes(reg_address, std::array<std::uint8_t, 1UL>{byte});
     }
 
+    void I2CDevice::write_bytes(std::uint8_t const reg_address,
+                                std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (this->initialized_ && bytes.size() <= MAX_TRANSFER_SIZE) {
+            this->execute([this, reg_address, bytes] {
+                return HAL_I2C_Mem_Write(this->i2c_bus_,
+                                         this->dev_address_ << 1,
+                                         reg_address,
+                                         sizeof(reg_address),
+                                         const_cast<std::uint8_t*>(bytes.data()),
+                                         static_cast<std::uint16_t>(bytes.size()),
+                                         TIMEOUT);
+            });
+        }
+    }
+
     std::uint16_t I2CDevice::dev_address() const noexcept
     {
         return this->dev_address_;
     }
 
+    bool I2CDevice::is_initialized() const noexcept
+    {
+        return this->initialized_;
+    }
+
     void I2CDevice::initialize() noexcept
     {
-        if (this->i2c_bus_ != nullptr) {
-            if (HAL_I2C_IsDeviceReady(this->i2c_bus_, this->dev_address_ << 1, SCAN_RETRIES, TIMEOUT) == HAL_OK) {
+        if (this->bus_ != nullptr) {
+            if (!this->bus_->is_scanned()) {
+                this->bus_->scan();
+            }
+            this->initialized_ = this->bus_->is_device_present(this->dev_address_);
+        } else if (this->i2c_bus_ != nullptr) {
+            if (this->execute([this] {
+                    return HAL_I2C_IsDeviceReady(this->i2c_bus_, this->dev_address_ << 1, SCAN_TRIALS, SCAN_TIMEOUT);
+                }) == HAL_OK) {
                 this->initialized_ = true;
             }
         }
@@ -2,7 +2,9 @@
 #define I2C_DEVICE_HPP
 
 #include "common.hpp"
+#include "i2c_bus.hpp"
 #include "utility.hpp"
+#include <span>
 
 namespace Utility {
 
@@ -10,6 +12,7 @@ namespace Utility {
     public:
         I2CDevice() noexcept = default;
         I2CDevice(I2CHandle const i2c_bus, std::uint16_t const dev_address) noexcept;
+        I2CDevice(I2CBus& i2c_bus, std::uint16_t const dev_address) noexcept;
 
         I2CDevice(I2CDevice const& other) = delete;
         I2CDevice(I2CDevice&& other) noexcept = default;
@@ -67,20 +70,38 @@ namespace Utility {
         void write_bytes(std::uint8_t const reg_address, std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
         void write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
 
+        void write_bytes(std::uint8_t const reg_address, std::span<std::uint8_t const> const bytes) const noexcept;
+
         std::uint16_t dev_address() const noexcept;
+        [[nodiscard]] bool is_initialized() const noexcept;
 
     private:
         static constexpr std::uint32_t TIMEOUT{100U};
-        static constexpr std::uint32_t SCAN_RETRIES{10U};
+        static constexpr std::uint32_t SCAN_TRIALS{1U};
+        static constexpr std::uint32_t SCAN_TIMEOUT{1U};
+        static constexpr std::size_t MAX_TRANSFER_SIZE{0xFFFFU};
+
+        template <typename Transaction>
+        HAL_StatusTypeDef execute(Transaction&& transaction) const noexcept;
 
         void initialize() noexcept;
 
         bool initialized_{false};
 
         I2CHandle i2c_bus_{nullptr};
+        I2CBus* bus_{nullptr};
         std::uint16_t dev_address_{};
     };
 
+    template <typename Transaction>
+    HAL_StatusTypeDef I2CDevice::execute(Transaction&& transaction) const noexcept
+    {
+        if (this->bus_ != nullptr) {
+            return this->bus_->execute(std::forward<Transaction>(transaction));
+        }
+        return transaction();
+    }
+
     template <std::size_t SIZE>
     void I2CDevice::transmit_dwords(std::array<std::uint32_t, SIZE> const& dwords) const noexcept
     {
@@ -98,7 +119,13 @@ namespace Utility {
     {
         std::array<std::uint8_t, SIZE> transmit{bytes};
         if (this->initialized_) {
-            HAL_I2C_Master_Transmit(this->i2c_bus_, this->dev_address_ << 1, transmit.data(), transmit.size(), TIMEOUT);
+            this->execute([this, &transmit] {
+                return HAL_I2C_Master_Transmit(this->i2c_bus_,
+                                               this->dev_address_ << 1,
+                                               transmit.data(),
+                                               transmit.size(),
+                                               TIMEOUT);
+            });
         }
     }
 
@@ -119,7 +146,13 @@ namespace Utility {
     {
         std::array<std::uint8_t, SIZE> receive{};
         if (this->initialized_) {
-            HAL_I2C_Master_Receive(this->i2c_bus_, this->dev_address_ << 1, receive.data(), receive.size(), TIMEOUT);
+            this->execute([this, &receive] {
+                return HAL_I2C_Master_Receive(this->i2c_bus_,
+                                              this->dev_address_ << 1,
+                                              receive.data(),
+                                              receive.size(),
+                                              TIMEOUT);
+            });
         }
         return receive;
     }
@@ -141,13 +174,15 @@ namespace Utility {
     {
         std::array<std::uint8_t, SIZE> read{};
         if (this->initialized_) {
-            HAL_I2C_Mem_Read(this->i2c_bus_,
-                             this->dev_address_ << 1,
-                             reg_address,
-                             sizeof(reg_address),
-                             read.data(),
-                             read.size(),
-                             TIMEOUT);
+            this->execute([this, reg_address, &read] {
+                return HAL_I2C_Mem_Read(this->i2c_bus_,
+                                        this->dev_address_ << 1,
+                                        reg_address,
+                                        sizeof(reg_address),
+                                        read.data(),
+                                        read.size(),
+                                        TIMEOUT);
+            });
         }
         return read;
     }
@@ -172,13 +207,15 @@ namespace Utility {
     {
         if (this->initialized_) {
             std::array<std::uint8_t, SIZE> write{bytes};
-            HAL_I2C_Mem_Write(this->i2c_bus_,
-                              this->dev_address_ << 1,
-                              reg_address,
-                              sizeof(reg_address),
-                              write.data(),
-                              write.size(),
-                              TIMEOUT);
+            this->execute([this, reg_address, &write] {
+                return HAL_I2C_Mem_Write(this->i2c_bus_,
+                                         this->dev_address_ << 1,
+                                         reg_address,
+                                         sizeof(reg_address),
+                                         write.data(),
+                                         write.size(),
+                                         TIMEOUT);
+            });
         }
     }
 
@@ -0,0 +1,167 @@
+#include "i2c_topology.hpp"
+
+namespace Utility {
+
+    I2CTopology::I2CTopology(std::array<I2CBus*, MAX_BUSES> const& buses,
+                             std::uint8_t const reg_address,
+                             std::size_t const read_size) noexcept :
+        reg_address_{reg_address}, read_size_{std::clamp(read_size, std::size_t{1U}, MAX_READ_SIZE)}
+    {
+        for (std::size_t bus_index{}; bus_index < MAX_BUSES; ++bus_index) {
+            this->bus_slots_[bus_index].bus = buses[bus_index];
+        }
+    }
+
+    std::optional<std::size_t> I2CTopology::add_device(std::size_t const bus_index,
+                                                       std::uint16_t const dev_address) noexcept
+    {
+        if (bus_index >= MAX_BUSES || this->device_count_ == MAX_DEVICES || this->refreshing_) {
+            return std::optional<std::size_t>{std::nullopt};
+        }
+
+        auto& bus_slot{this->bus_slots_[bus_index]};
+        if (bus_slot.bus == nullptr) {
+            return std::optional<std::size_t>{std::nullopt};
+        }
+
+        auto const device_index{this->device_count_++};
+        bus_slot.transfers[bus_slot.transfer_count++] =
+            I2CTransfer{.direction = I2CTransfer::Direction::READ,
+                        .dev_address = dev_address,
+                        .reg_address = this->reg_address_,
+                        .data = std::span<std::uint8_t>{this->back_image_[device_index].data(), this->read_size_}};
+        return std::optional<std::size_t>{device_index};
+    }
+
+    std::size_t I2CTopology::add_present_devices(std::uint16_t const first_address,
+                                                 std::uint16_t const last_address) noexcept
+    {
+        std::size_t added{};
+        for (std::size_t bus_index{}; bus_index < MAX_BUSES; ++bus_index) {
+            auto* const bus{this->bus_slots_[bus_index].bus};
+            if (bus == nullptr) {
+                continue;
+            }
+            if (!bus->is_scanned()) {
+                bus->scan();
+            }
+            for (auto dev_address{first_address}; dev_address <= last_address; ++dev_address) {
+                if (bus->is_device_present(dev_address) && this->add_device(bus_index, dev_address).has_value()) {
+                    ++added;
+                }
+            }
+        }
+        return added;
+    }
+
+    bool I2CTopology::start_refresh() noexcept
+    {
+        if (this->refreshing_) {
+            return false;
+        }
+
+        this->refresh_status_ = HAL_OK;
+        for (auto& bus_slot : this->bus_slots_) {
+            bus_slot.started = false;
+            if (bus_slot.bus == nullptr || bus_slot.transfer_count == 0U) {
+                continue;
+            }
+            bus_slot.started = bus_slot.bus->start_sequence(
+                std::span<I2CTransfer const>{bus_slot.transfers.data(), bus_slot.transfer_count});
+            if (!bus_slot.started) {
+                this->refresh_status_ = HAL_ERROR;
+            }
+        }
+        this->refreshing_ = true;
+        return this->refresh_status_ == HAL_OK;
+    }
+
+    bool I2CTopology::poll_refresh() noexcept
+    {
+        if (!this->refreshing_) {
+            return true;
+        }
+
+        for (auto const& bus_slot : this->bus_slots_) {
+            if (bus_slot.started && bus_slot.bus->is_sequence_busy()) {
+                return false;
+            }
+        }
+
+        auto status{this->refresh_status_};
+        for (auto const& bus_slot : this->bus_slots_) {
+            if (bus_slot.started && bus_slot.bus->sequence_status() != HAL_OK) {
+                status = bus_slot.bus->sequence_status();
+            }
+        }
+        this->finish_refresh(status);
+        return true;
+    }
+
+    HAL_StatusTypeDef I2CTopology::refresh() noexcept
+    {
+        if (this->refreshing_) {
+            return HAL_BUSY;
+        }
+        if (!this->start_refresh()) {
+            this->abort_refresh(HAL_ERROR);
+            return HAL_ERROR;
+        }
+
+        auto const start_tick{HAL_GetTick()};
+        while (!this->poll_refresh()) {
+            if (HAL_GetTick() - start_tick > REFRESH_TIMEOUT) {
+                this->abort_refresh(HAL_TIMEOUT);
+                return HAL_TIMEOUT;
+            }
+        }
+        return this->refresh_status_;
+    }
+
+    std::span<std::uint8_t const> I2CTopology::get_device_image(std::size_t const device_index) const noexcept
+    {
+        if (device_index >= this->device_count_) {
+            return std::span<std::uint8_t const>{};
+        }
+        return std::span<std::uint8_t const>{this->front_image_[device_index].data(), this->read_size_};
+    }
+
+    std::size_t I2CTopology::device_count() const noexcept
+    {
+        return this->device_count_;
+    }
+
+    HAL_StatusTypeDef I2CTopology::refresh_status() const noexcept
+    {
+        return this->refresh_status_;
+    }
+
+    void I2CTopology::abort_refresh(HAL_StatusTypeDef const status) noexcept
+    {
+        // a bus that refused the sequence may be running someone else's
+        for (auto const& bus_slot : this->bus_slots_) {
+            if (bus_slot.started) {
+                bus_slot.bus->abort_sequence(status);
+            }
+        }
+        this->finish_refresh(status);
+    }
+
+    void I2CTopology::finish_refresh(HAL_StatusTypeDef const status) noexcept
+    {
+        this->refresh_status_ = status;
+        if (status == HAL_OK) {
+            this->publish_image();
+        }
+        this->refreshing_ = false;
+        for (auto& bus_slot : this->bus_slots_) {
+            bus_slot.started = false;
+        }
+    }
+
+    void I2CTopology::publish_image() noexcept
+    {
+        std::copy_n(this->back_image_.begin(), this->device_count_, this->front_image_.begin());
+    }
+
+}; // namespace Utility
@@ -0,0 +1,71 @@
+#ifndef I2C_TOPOLOGY_HPP
+#define I2C_TOPOLOGY_HPP
+
+#include "common.hpp"
+#include "i2c_bus.hpp"
+#include "utility.hpp"
+#include <optional>
+#include <span>
+
+namespace Utility {
+
+    struct I2CTopology {
+    public:
+        static constexpr std::size_t MAX_BUSES{3U};
+        static constexpr std::size_t MAX_DEVICES{24U};
+        static constexpr std::size_t MAX_READ_SIZE{4U};
+
+        I2CTopology() noexcept = default;
+        I2CTopology(std::array<I2CBus*, MAX_BUSES> const& buses,
+                    std::uint8_t const reg_address,
+                    std::size_t const read_size) noexcept;
+
+        I2CTopology(I2CTopology const& other) = delete;
+        I2CTopology(I2CTopology&& other) noexcept = delete;
+
+        I2CTopology& operator=(I2CTopology const& other) = delete;
+        I2CTopology& operator=(I2CTopology&& other) noexcept = delete;
+
+        ~I2CTopology() noexcept = default;
+
+        std::optional<std::size_t> add_device(std::size_t const bus_index, std::uint16_t const dev_address) noexcept;
+        std::size_t add_present_devices(std::uint16_t const first_address, std::uint16_t const last_address) noexcept;
+
+        bool start_refresh() noexcept;
+        [[nodiscard]] bool poll_refresh() noexcept;
+        HAL_StatusTypeDef refresh() noexcept;
+
+        [[nodiscard]] std::span<std::uint8_t const> get_device_image(std::size_t const device_index) const noexcept;
+        [[nodiscard]] std::size_t device_count() const noexcept;
+        [[nodiscard]] HAL_StatusTypeDef refresh_status() const noexcept;
+
+    private:
+        static constexpr std::uint32_t REFRESH_TIMEOUT{100U};
+
+        struct BusSlot {
+            I2CBus* bus{nullptr};
+            std::array<I2CTransfer, MAX_DEVICES> transfers{};
+            std::size_t transfer_count{};
+            bool started{false};
+        };
+
+        void abort_refresh(HAL_StatusTypeDef const status) noexcept;
+        void finish_refresh(HAL_StatusTypeDef const status) noexcept;
+        void publish_image() noexcept;
+
+        std::array<BusSlot, MAX_BUSES> bus_slots_{};
+
+        std::uint8_t reg_address_{};
+        std::size_t read_size_{};
+
+        std::size_t device_count_{};
+        std::array<std::array<std::uint8_t, MAX_READ_SIZE>, MAX_DEVICES> back_image_{};
+        std::array<std::array<std::uint8_t, MAX_READ_SIZE>, MAX_DEVICES> front_image_{};
+
+        bool refreshing_{false};
+        HAL_StatusTypeDef refresh_status_{HAL_OK};
+    };
+
+}; // namespace Utility
+
+#endif // I2C_TOPOLOGY_HPP
@@ -0,0 +1,7 @@
+#include "i2c_write_combiner.hpp"
+
+namespace Utility {
+
+    template struct WriteCombiner<I2CDevice>;
+
+}; // namespace Utility
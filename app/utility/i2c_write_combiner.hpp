@@ -0,0 +1,244 @@
+#ifndef I2C_WRITE_COMBINER_HPP
+#define I2C_WRITE_COMBINER_HPP
+
+#include "common.hpp"
+#include "i2c_device.hpp"
+#include "utility.hpp"
+#include <concepts>
+#include <span>
+
+namespace Utility {
+
+    template <typename T>
+    concept RegisterTransport =
+        requires(T const& device, std::uint8_t const reg_address, std::span<std::uint8_t const> const bytes) {
+            { device.is_initialized() } -> std::same_as<bool>;
+            { device.template read_bytes<1UL>(reg_address) } -> std::same_as<std::array<std::uint8_t, 1UL>>;
+            { device.write_bytes(reg_address, bytes) };
+        };
+
+    // Buffers register writes of one device and issues them as sequential multi-byte writes.
+    // Ordering: writes reach the bus in program order. A write to the register written just before it collapses
+    // to the last value, and consecutive writes to ascending registers are merged into one auto-increment write.
+    // flush()/barrier() put every buffered write on the bus before returning; reads through the combiner act as
+    // a barrier.
+    template <RegisterTransport Device>
+    struct WriteCombiner {
+    public:
+        struct Stats {
+            std::uint32_t write_count{};
+            std::uint32_t dropped_write_count{};
+            std::uint32_t transaction_count{};
+        };
+
+        WriteCombiner() noexcept = default;
+        WriteCombiner(Device&& device, std::uint32_t const window_ms) noexcept;
+
+        WriteCombiner(WriteCombiner const& other) = delete;
+        WriteCombiner(WriteCombiner&& other) noexcept;
+
+        WriteCombiner& operator=(WriteCombiner const& other) = delete;
+        WriteCombiner& operator=(WriteCombiner&& other) noexcept;
+
+        ~WriteCombiner() noexcept;
+
+        template <std::size_t SIZE>
+        std::array<std::uint8_t, SIZE> read_bytes(std::uint8_t const reg_address) const noexcept;
+        std::uint8_t read_byte(std::uint8_t const reg_address) const noexcept;
+
+        template <std::size_t SIZE>
+        void write_bytes(std::uint8_t const reg_address, std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
+        void write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+        void flush() const noexcept;
+        void barrier() const noexcept;
+        void poll() const noexcept;
+
+        [[nodiscard]] bool is_initialized() const noexcept;
+        [[nodiscard]] Stats const& stats() const noexcept;
+        [[nodiscard]] Device const& device() const noexcept;
+
+    private:
+        static constexpr std::size_t MAX_PENDING_WRITES{32U};
+
+        struct PendingWrite {
+            std::uint8_t reg_address{};
+            std::uint8_t byte{};
+        };
+
+        void buffer_write(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+        bool is_window_expired() const noexcept;
+
+        Device device_{};
+        std::uint32_t window_ms_{};
+
+        std::array<PendingWrite, MAX_PENDING_WRITES> mutable pending_writes_{};
+        std::size_t mutable pending_count_{};
+        std::uint32_t mutable window_start_tick_{};
+
+        Stats mutable stats_{};
+    };
+
+    using I2CWriteCombiner = WriteCombiner<I2CDevice>;
+
+    template <RegisterTransport Device>
+    WriteCombiner<Device>::WriteCombiner(Device&& device, std::uint32_t const window_ms) noexcept :
+        device_{std::forward<Device>(device)}, window_ms_{window_ms}
+    {}
+
+    template <RegisterTransport Device>
+    WriteCombiner<Device>::WriteCombiner(WriteCombiner&& other) noexcept :
+        device_{std::move(other.device_)},
+        window_ms_{other.window_ms_},
+        pending_writes_{other.pending_writes_},
+        pending_count_{other.pending_count_},
+        window_start_tick_{other.window_start_tick_},
+        stats_{other.stats_}
+    {
+        other.pending_count_ = 0U;
+    }
+
+    template <RegisterTransport Device>
+    WriteCombiner<Device>& WriteCombiner<Device>::operator=(WriteCombiner&& other) noexcept
+    {
+        if (this != &other) {
+            this->flush();
+            this->device_ = std::move(other.device_);
+            this->window_ms_ = other.window_ms_;
+            this->pending_writes_ = other.pending_writes_;
+            this->pending_count_ = other.pending_count_;
+            this->window_start_tick_ = other.window_start_tick_;
+            this->stats_ = other.stats_;
+            other.pending_count_ = 0U;
+        }
+        return *this;
+    }
+
+    template <RegisterTransport Device>
+    WriteCombiner<Device>::~WriteCombiner() noexcept
+    {
+        this->flush();
+    }
+
+    template <RegisterTransport Device>
+    template <std::size_t SIZE>
+    std::array<std::uint8_t, SIZE> WriteCombiner<Device>::read_bytes(std::uint8_t const reg_address) const noexcept
+    {
+        this->barrier();
+        return this->device_.template read_bytes<SIZE>(reg_address);
+    }
+
+    template <RegisterTransport Device>
+    std::uint8_t WriteCombiner<Device>::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        return this->read_bytes<1UL>(reg_address)[0];
+    }
+
+    template <RegisterTransport Device>
+    template <std::size_t SIZE>
+    void WriteCombiner<Device>::write_bytes(std::uint8_t const reg_address,
+                                            std::array<std::uint8_t, SIZE> const& bytes) const noexcept
+    {
+        for (std::size_t i{}; i < bytes.size(); ++i) {
+            this->buffer_write(static_cast<std::uint8_t>(reg_address + i), bytes[i]);
+        }
+    }
+
+    template <RegisterTransport Device>
+    void WriteCombiner<Device>::write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+    {
+        this->buffer_write(reg_address, byte);
+    }
+
+    template <RegisterTransport Device>
+    void WriteCombiner<Device>::flush() const noexcept
+    {
+        std::array<std::uint8_t, MAX_PENDING_WRITES> run{};
+        std::size_t run_begin{};
+
+        while (run_begin < this->pending_count_) {
+            auto run_end{run_begin + 1U};
+            while (run_end < this->pending_count_ &&
+                   this->pending_writes_[run_end].reg_address ==
+                       this->pending_writes_[run_end - 1U].reg_address + 1U) {
+                ++run_end;
+            }
+
+            for (auto i{run_begin}; i < run_end; ++i) {
+                run[i - run_begin] = this->pending_writes_[i].byte;
+            }
+            this->device_.write_bytes(this->pending_writes_[run_begin].reg_address,
+                                      std::span<std::uint8_t const>{run.data(), run_end - run_begin});
+            ++this->stats_.transaction_count;
+
+            run_begin = run_end;
+        }
+
+        this->pending_count_ = 0U;
+    }
+
+    template <RegisterTransport Device>
+    void WriteCombiner<Device>::barrier() const noexcept
+    {
+        this->flush();
+    }
+
+    template <RegisterTransport Device>
+    void WriteCombiner<Device>::poll() const noexcept
+    {
+        if (this->is_window_expired()) {
+            this->flush();
+        }
+    }
+
+    template <RegisterTransport Device>
+    bool WriteCombiner<Device>::is_initialized() const noexcept
+    {
+        return this->device_.is_initialized();
+    }
+
+    template <RegisterTransport Device>
+    typename WriteCombiner<Device>::Stats const& WriteCombiner<Device>::stats() const noexcept
+    {
+        return this->stats_;
+    }
+
+    template <RegisterTransport Device>
+    Device const& WriteCombiner<Device>::device() const noexcept
+    {
+        return this->device_;
+    }
+
+    template <RegisterTransport Device>
+    void WriteCombiner<Device>::buffer_write(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+    {
+        if (this->is_window_expired() || this->pending_count_ == this->pending_writes_.size()) {
+            this->flush();
+        }
+        if (this->pending_count_ == 0U) {
+            this->window_start_tick_ = HAL_GetTick();
+        }
+        ++this->stats_.write_count;
+
+        if (this->pending_count_ > 0U) {
+            auto& last{this->pending_writes_[this->pending_count_ - 1U]};
+            if (last.reg_address == reg_address) {
+                last.byte = byte;
+                ++this->stats_.dropped_write_count;
+                return;
+            }
+        }
+
+        this->pending_writes_[this->pending_count_] = PendingWrite{reg_address, byte};
+        ++this->pending_count_;
+    }
+
+    template <RegisterTransport Device>
+    bool WriteCombiner<Device>::is_window_expired() const noexcept
+    {
+        return this->pending_count_ > 0U && HAL_GetTick() - this->window_start_tick_ >= this->window_ms_;
+    }
+
+}; // namespace Utility
+
+#endif // I2C_WRITE_COMBINER_HPP
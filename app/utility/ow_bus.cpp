@@ -0,0 +1,544 @@
+#include "ow_bus.hpp"
+#include "handle_registry.hpp"
+#include "timer_clock.hpp"
+
+namespace Utility {
+
+    namespace {
+
+        HandleRegistry<UARTHandle, OWBus, 2U> ow_uart_registry{};
+        HandleRegistry<TIMHandle, OWBus, 2U> ow_timer_registry{};
+
+    }; // namespace
+
+    OWBus::OWBus(UARTHandle const uart) noexcept : backend_{Backend::UART}, uart_{uart}
+    {}
+
+    OWBus::OWBus(TIMHandle const timer, std::uint32_t const timer_channel, GPIO const dev_pin) noexcept :
+        backend_{Backend::TIMER}, timer_{timer}, timer_channel_{timer_channel}, dev_pin_{dev_pin}
+    {}
+
+    bool OWBus::start_job(std::span<std::uint8_t const> const transmit, std::size_t const receive_size) noexcept
+    {
+        return this->start_job(transmit, receive_size, true);
+    }
+
+    bool OWBus::start_job(std::span<std::uint8_t const> const transmit,
+                          std::size_t const receive_size,
+                          bool const reset) noexcept
+    {
+        if (this->backend_ == Backend::NONE || this->job_state_ != JobState::IDLE ||
+            transmit.size() + receive_size > MAX_JOB_BYTES || (!reset && transmit.size() + receive_size == 0U)) {
+            return false;
+        }
+
+        this->slot_count_ = 0U;
+        for (auto const byte : transmit) {
+            for (std::uint8_t bit{}; bit < 8U; ++bit) {
+                this->transmit_slots_[this->slot_count_++] = read_bit(byte, bit) ? SLOT_ONE : SLOT_ZERO;
+            }
+        }
+        for (std::size_t slot{}; slot < 8U * receive_size; ++slot) {
+            this->transmit_slots_[this->slot_count_++] = SLOT_ONE;
+        }
+        this->transmit_size_ = transmit.size();
+        this->receive_size_ = receive_size;
+
+        return this->start_slot_job(reset ? JobState::RESET : JobState::SLOTS);
+    }
+
+    bool OWBus::is_busy() const noexcept
+    {
+        return this->job_state_ != JobState::IDLE;
+    }
+
+    HAL_StatusTypeDef OWBus::wait() const noexcept
+    {
+        auto const start_tick{HAL_GetTick()};
+        while (this->is_busy()) {
+            if (HAL_GetTick() - start_tick > TIMEOUT) {
+                return HAL_TIMEOUT;
+            }
+        }
+        return this->job_status_;
+    }
+
+    void OWBus::abort_job() noexcept
+    {
+        if (this->job_state_ != JobState::IDLE) {
+            this->finish_job(HAL_TIMEOUT);
+        }
+    }
+
+    HAL_StatusTypeDef OWBus::transfer(std::span<std::uint8_t const> const transmit,
+                                      std::span<std::uint8_t> const receive) noexcept
+    {
+        if (!this->start_job(transmit, receive.size())) {
+            return HAL_ERROR;
+        }
+        auto const status{this->wait()};
+        if (status == HAL_OK) {
+            std::copy_n(this->received_.begin(), receive.size(), receive.begin());
+        }
+        return status;
+    }
+
+    HAL_StatusTypeDef OWBus::transfer_bits(std::span<bool const> const transmit, std::span<bool> const receive) noexcept
+    {
+        if (this->backend_ == Backend::NONE || this->job_state_ != JobState::IDLE || transmit.empty() ||
+            transmit.size() > MAX_JOB_SLOTS || receive.size() > transmit.size()) {
+            return HAL_ERROR;
+        }
+
+        this->slot_count_ = 0U;
+        for (auto const bit : transmit) {
+            this->transmit_slots_[this->slot_count_++] = bit ? SLOT_ONE : SLOT_ZERO;
+        }
+        this->transmit_size_ = 0U;
+        this->receive_size_ = 0U;
+
+        if (!this->start_slot_job(JobState::SLOTS)) {
+            return HAL_ERROR;
+        }
+        auto const status{this->wait()};
+        if (status == HAL_OK) {
+            for (std::size_t slot{}; slot < receive.size(); ++slot) {
+                receive[slot] = this->receive_slots_[slot] == SLOT_ONE;
+            }
+        }
+        return status;
+    }
+
+    HAL_StatusTypeDef OWBus::broadcast(std::span<std::uint8_t const> const transmit) noexcept
+    {
+        if (1UL + transmit.size() > MAX_JOB_BYTES || !this->set_speed(OWSpeed::STANDARD)) {
+            return HAL_ERROR;
+        }
+        std::array<std::uint8_t, MAX_JOB_BYTES> frame{};
+        frame[0] = SKIP_ROM;
+        std::copy(transmit.begin(), transmit.end(), frame.begin() + 1UL);
+        return this->transfer(std::span<std::uint8_t const>{frame.data(), 1UL + transmit.size()},
+                              std::span<std::uint8_t>{});
+    }
+
+    bool OWBus::reset() noexcept
+    {
+        return this->transfer(std::span<std::uint8_t const>{}, std::span<std::uint8_t>{}) == HAL_OK;
+    }
+
+    bool OWBus::set_speed(OWSpeed const speed) noexcept
+    {
+        if (this->job_state_ != JobState::IDLE || (speed == OWSpeed::OVERDRIVE && !this->supports_overdrive())) {
+            return false;
+        }
+        this->speed_ = speed;
+        this->uart_timing_ = OW_UART_TIMINGS[std::to_underlying(speed)];
+        return true;
+    }
+
+    OWSpeed OWBus::speed() const noexcept
+    {
+        return this->speed_;
+    }
+
+    bool OWBus::supports_overdrive() const noexcept
+    {
+        return this->backend_ == Backend::UART;
+    }
+
+    bool OWBus::is_overdrive(std::uint64_t const rom) const noexcept
+    {
+        if (this->overdrive_all_) {
+            return true;
+        }
+        auto const overdrive_roms{std::span<std::uint64_t const>{this->overdrive_roms_.data(), this->overdrive_count_}};
+        return std::find(overdrive_roms.begin(), overdrive_roms.end(), rom) != overdrive_roms.end();
+    }
+
+    void OWBus::mark_overdrive(std::uint64_t const rom) noexcept
+    {
+        if (rom == 0ULL) {
+            this->overdrive_all_ = true;
+        } else if (!this->is_overdrive(rom) && this->overdrive_count_ < MAX_ROMS) {
+            this->overdrive_roms_[this->overdrive_count_++] = rom;
+        }
+    }
+
+    bool OWBus::search() noexcept
+    {
+        if (!this->searched_ && this->set_speed(OWSpeed::STANDARD)) {
+            this->rom_count_ = this->search_roms(SEARCH_ROM, this->roms_);
+            this->searched_ = this->rom_count_ > 0U;
+        }
+        return this->searched_;
+    }
+
+    std::size_t OWBus::search_alarms(std::span<std::uint64_t> const alarm_roms) noexcept
+    {
+        if (!this->set_speed(OWSpeed::STANDARD)) {
+            return 0U;
+        }
+        return this->search_roms(ALARM_SEARCH, alarm_roms);
+    }
+
+    bool OWBus::is_searched() const noexcept
+    {
+        return this->searched_;
+    }
+
+    bool OWBus::is_rom_present(std::uint64_t const rom) const noexcept
+    {
+        auto const roms{this->roms()};
+        return std::find(roms.begin(), roms.end(), rom) != roms.end();
+    }
+
+    std::span<std::uint64_t const> OWBus::roms() const noexcept
+    {
+        return std::span<std::uint64_t const>{this->roms_.data(), this->rom_count_};
+    }
+
+    std::size_t OWBus::rom_count() const noexcept
+    {
+        return this->rom_count_;
+    }
+
+    bool OWBus::is_present() const noexcept
+    {
+        return this->present_;
+    }
+
+    HAL_StatusTypeDef OWBus::job_status() const noexcept
+    {
+        return this->job_status_;
+    }
+
+    std::span<std::uint8_t const> OWBus::received() const noexcept
+    {
+        return std::span<std::uint8_t const>{this->received_.data(), this->receive_size_};
+    }
+
+    void OWBus::uart_receive_complete_callback() noexcept
+    {
+        switch (this->job_state_) {
+            case JobState::RESET:
+                this->present_ = this->reset_echo_ != this->uart_timing_.reset_byte;
+                if (!this->present_) {
+                    this->finish_job(HAL_ERROR);
+                } else if (this->slot_count_ == 0U) {
+                    this->finish_job(HAL_OK);
+                } else {
+                    this->job_state_ = JobState::SLOTS;
+                    if (this->start_uart_slots() != HAL_OK) {
+                        this->finish_job(HAL_ERROR);
+                    }
+                }
+                break;
+            case JobState::SLOTS:
+                this->decode_slots();
+                this->finish_job(HAL_OK);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void OWBus::uart_error_callback() noexcept
+    {
+        if (this->job_state_ != JobState::IDLE && this->uart_->RxState == HAL_UART_STATE_READY) {
+            this->finish_job(HAL_ERROR);
+        }
+    }
+
+    void OWBus::timer_compare_callback() noexcept
+    {
+        auto const active_channel{static_cast<HAL_TIM_ActiveChannel>(1U << (this->timer_channel_ / 4U))};
+        if (this->job_state_ == JobState::IDLE || this->timer_->Channel != active_channel) {
+            return;
+        }
+
+        switch (this->timer_phase_) {
+            case TimerPhase::RESET_LOW:
+                gpio_set_pin(this->dev_pin_);
+                this->timer_phase_ = TimerPhase::PRESENCE_SAMPLE;
+                this->schedule_timer_compare(this->timer_timing_.presence_sample_us);
+                break;
+            case TimerPhase::PRESENCE_SAMPLE:
+                this->present_ = gpio_read_pin(this->dev_pin_) == GPIO_PIN_RESET;
+                this->timer_phase_ = TimerPhase::RESET_RECOVERY;
+                this->schedule_timer_compare(this->timer_timing_.reset_recovery_us);
+                break;
+            case TimerPhase::RESET_RECOVERY:
+                if (!this->present_) {
+                    this->finish_job(HAL_ERROR);
+                } else if (this->slot_count_ == 0U) {
+                    this->finish_job(HAL_OK);
+                } else {
+                    this->job_state_ = JobState::SLOTS;
+                    this->slot_index_ = 0U;
+                    this->start_timer_slot();
+                }
+                break;
+            case TimerPhase::SLOT_LOW:
+                gpio_set_pin(this->dev_pin_);
+                if (this->transmit_slots_[this->slot_index_] == SLOT_ONE) {
+                    this->timer_phase_ = TimerPhase::SLOT_SAMPLE;
+                    this->schedule_timer_compare(this->timer_timing_.read_sample_us -
+                                                 this->timer_timing_.write_one_low_us);
+                } else {
+                    this->receive_slots_[this->slot_index_] = SLOT_ZERO;
+                    this->timer_phase_ = TimerPhase::SLOT_RECOVERY;
+                    this->schedule_timer_compare(this->timer_timing_.slot_us - this->timer_timing_.write_zero_low_us);
+                }
+                break;
+            case TimerPhase::SLOT_SAMPLE:
+                this->receive_slots_[this->slot_index_] =
+                    gpio_read_pin(this->dev_pin_) == GPIO_PIN_SET ? SLOT_ONE : SLOT_ZERO;
+                this->timer_phase_ = TimerPhase::SLOT_RECOVERY;
+                this->schedule_timer_compare(this->timer_timing_.slot_us - this->timer_timing_.read_sample_us);
+                break;
+            case TimerPhase::SLOT_RECOVERY:
+                this->slot_index_ = this->slot_index_ + 1U;
+                if (this->slot_index_ == this->slot_count_) {
+                    this->decode_slots();
+                    this->finish_job(HAL_OK);
+                } else {
+                    this->start_timer_slot();
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool OWBus::start_slot_job(JobState const first_state) noexcept
+    {
+        auto const registered{this->backend_ == Backend::UART ? ow_uart_registry.insert(this->uart_, this)
+                                                               : ow_timer_registry.insert(this->timer_, this)};
+        if (!registered) {
+            return false;
+        }
+
+        if (first_state == JobState::RESET && this->speed_ == OWSpeed::STANDARD) {
+            this->overdrive_count_ = 0U;
+            this->overdrive_all_ = false;
+        }
+
+        this->job_status_ = HAL_BUSY;
+        this->job_state_ = first_state;
+        auto const status{first_state == JobState::RESET ? this->start_reset() : this->start_slots()};
+        if (status != HAL_OK) {
+            this->finish_job(HAL_ERROR);
+            return false;
+        }
+        return true;
+    }
+
+    HAL_StatusTypeDef OWBus::start_reset() noexcept
+    {
+        return this->backend_ == Backend::UART ? this->start_uart_reset() : this->start_timer_reset();
+    }
+
+    HAL_StatusTypeDef OWBus::start_slots() noexcept
+    {
+        return this->backend_ == Backend::UART ? this->start_uart_slots() : this->start_timer_slots();
+    }
+
+    void OWBus::finish_job(HAL_StatusTypeDef const status) noexcept
+    {
+        if (this->backend_ == Backend::UART) {
+            if (status != HAL_OK) {
+                HAL_UART_Abort(this->uart_);
+            }
+            ow_uart_registry.erase(this->uart_);
+        } else {
+            HAL_TIM_OC_Stop_IT(this->timer_, this->timer_channel_);
+            gpio_set_pin(this->dev_pin_);
+            ow_timer_registry.erase(this->timer_);
+        }
+        this->job_status_ = status;
+        this->job_state_ = JobState::IDLE;
+    }
+
+    void OWBus::decode_slots() noexcept
+    {
+        auto const first_slot{8U * this->transmit_size_};
+        for (std::size_t byte{}; byte < this->receive_size_; ++byte) {
+            std::uint8_t value{};
+            for (std::uint8_t bit{}; bit < 8U; ++bit) {
+                write_bit(value, this->receive_slots_[first_slot + 8U * byte + bit] == SLOT_ONE, bit);
+            }
+            this->received_[byte] = value;
+        }
+    }
+
+    HAL_StatusTypeDef OWBus::start_uart_reset() noexcept
+    {
+        this->set_uart_baud_rate(this->uart_timing_.reset_baud_rate);
+        if (HAL_UART_Receive_DMA(this->uart_, &this->reset_echo_, 1U) != HAL_OK) {
+            return HAL_ERROR;
+        }
+        return HAL_UART_Transmit_DMA(this->uart_, &this->uart_timing_.reset_byte, 1U);
+    }
+
+    HAL_StatusTypeDef OWBus::start_uart_slots() noexcept
+    {
+        this->set_uart_baud_rate(this->uart_timing_.slot_baud_rate);
+        auto const slot_count{static_cast<std::uint16_t>(this->slot_count_)};
+        if (HAL_UART_Receive_DMA(this->uart_, this->receive_slots_.data(), slot_count) != HAL_OK) {
+            return HAL_ERROR;
+        }
+        return HAL_UART_Transmit_DMA(this->uart_, this->transmit_slots_.data(), slot_count);
+    }
+
+    void OWBus::set_uart_baud_rate(std::uint32_t const baud_rate) const noexcept
+    {
+        auto* const instance{this->uart_->Instance};
+        instance->CR1 = instance->CR1 & ~USART_CR1_UE;
+        instance->BRR = (this->uart_clock_frequency() + baud_rate / 2U) / baud_rate;
+        instance->CR1 = instance->CR1 | USART_CR1_UE;
+        this->uart_->Init.BaudRate = baud_rate;
+    }
+
+    std::uint32_t OWBus::uart_clock_frequency() const noexcept
+    {
+        auto const* const instance{this->uart_->Instance};
+        if (instance == USART1) {
+            return HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_USART1);
+        }
+        if (instance == USART2) {
+            return HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_USART2);
+        }
+        if (instance == USART3) {
+            return HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_USART3);
+        }
+        if (instance == UART4) {
+            return HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_UART4);
+        }
+        if (instance == UART5) {
+            return HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_UART5);
+        }
+        return HAL_RCC_GetPCLK1Freq();
+    }
+
+    std::size_t OWBus::search_roms(std::uint8_t const command, std::span<std::uint64_t> const found) noexcept
+    {
+        std::size_t found_count{};
+        std::array<std::uint8_t, 8UL> rom{};
+        std::size_t last_discrepancy{};
+
+        do {
+            if (this->transfer(std::array<std::uint8_t, 1UL>{command}, std::span<std::uint8_t>{}) != HAL_OK) {
+                break;
+            }
+
+            std::size_t last_zero{};
+            std::size_t bit{1U};
+            for (; bit <= ROM_BITS; ++bit) {
+                std::array<bool, 2UL> id_bits{};
+                if (this->transfer_bits(std::array<bool, 2UL>{true, true}, id_bits) != HAL_OK ||
+                    (id_bits[0] && id_bits[1])) {
+                    break;
+                }
+
+                auto& rom_byte{rom[(bit - 1U) / 8U]};
+                auto const rom_bit{static_cast<std::uint8_t>((bit - 1U) % 8U)};
+                auto direction{id_bits[0]};
+                if (id_bits[0] == id_bits[1]) {
+                    direction = bit < last_discrepancy ? read_bit(rom_byte, rom_bit) : bit == last_discrepancy;
+                    if (!direction) {
+                        last_zero = bit;
+                    }
+                }
+                write_bit(rom_byte, direction, rom_bit);
+
+                if (this->transfer_bits(std::array<bool, 1UL>{direction}, std::span<bool>{}) != HAL_OK) {
+                    break;
+                }
+            }
+            if (bit <= ROM_BITS) {
+                break;
+            }
+
+            auto const found_rom{ow_bytes_to_rom(rom)};
+            if (ow_is_rom_valid(found_rom) && found_count < found.size()) {
+                found[found_count++] = found_rom;
+            }
+            last_discrepancy = last_zero;
+        } while (last_discrepancy != 0U && found_count < found.size());
+
+        return found_count;
+    }
+
+    HAL_StatusTypeDef OWBus::start_timer(TimerPhase const first_phase) noexcept
+    {
+        this->timer_ticks_per_us_ = timer_counter_frequency(this->timer_->Instance) / 1000000UL;
+        if (this->timer_ticks_per_us_ == 0UL) {
+            return HAL_ERROR;
+        }
+
+        __HAL_TIM_SET_COMPARE(this->timer_, this->timer_channel_, __HAL_TIM_GET_COUNTER(this->timer_));
+        if (first_phase == TimerPhase::RESET_LOW) {
+            gpio_reset_pin(this->dev_pin_);
+            this->timer_phase_ = TimerPhase::RESET_LOW;
+            this->schedule_timer_compare(this->timer_timing_.reset_low_us);
+        } else {
+            this->slot_index_ = 0U;
+            this->start_timer_slot();
+        }
+        __HAL_TIM_CLEAR_IT(this->timer_, TIM_IT_CC1 << (this->timer_channel_ / 4U));
+        return HAL_TIM_OC_Start_IT(this->timer_, this->timer_channel_);
+    }
+
+    HAL_StatusTypeDef OWBus::start_timer_reset() noexcept
+    {
+        return this->start_timer(TimerPhase::RESET_LOW);
+    }
+
+    HAL_StatusTypeDef OWBus::start_timer_slots() noexcept
+    {
+        return this->start_timer(TimerPhase::SLOT_LOW);
+    }
+
+    void OWBus::start_timer_slot() noexcept
+    {
+        gpio_reset_pin(this->dev_pin_);
+        this->timer_phase_ = TimerPhase::SLOT_LOW;
+        this->schedule_timer_compare(this->transmit_slots_[this->slot_index_] == SLOT_ONE
+                                         ? this->timer_timing_.write_one_low_us
+                                         : this->timer_timing_.write_zero_low_us);
+    }
+
+    void OWBus::schedule_timer_compare(std::uint32_t const delay_us) const noexcept
+    {
+        auto const period{__HAL_TIM_GET_AUTORELOAD(this->timer_) + 1UL};
+        auto const compare{__HAL_TIM_GET_COMPARE(this->timer_, this->timer_channel_)};
+        __HAL_TIM_SET_COMPARE(this->timer_,
+                              this->timer_channel_,
+                              (compare + delay_us * this->timer_ticks_per_us_) % period);
+    }
+
+}; // namespace Utility
+
+extern "C" {
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef* huart)
+{
+    if (auto* const ow_bus{Utility::ow_uart_registry.find(huart)}; ow_bus != nullptr) {
+        ow_bus->uart_receive_complete_callback();
+    }
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef* huart)
+{
+    if (auto* const ow_bus{Utility::ow_uart_registry.find(huart)}; ow_bus != nullptr) {
+        ow_bus->uart_error_callback();
+    }
+}
+
+void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef* htim)
+{
+    if (auto* const ow_bus{Utility::ow_timer_registry.find(htim)}; ow_bus != nullptr) {
+        ow_bus->timer_compare_callback();
+    }
+}
+}
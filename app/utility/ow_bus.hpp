@@ -0,0 +1,227 @@
+#ifndef OW_BUS_HPP
+#define OW_BUS_HPP
+
+#include "common.hpp"
+#include "crc.hpp"
+#include "gpio.hpp"
+#include "utility.hpp"
+#include <span>
+
+namespace Utility {
+
+    enum struct OWSpeed : std::uint8_t {
+        STANDARD,
+        OVERDRIVE,
+    };
+
+    struct OWUARTTiming {
+        std::uint32_t reset_baud_rate{};
+        std::uint8_t reset_byte{};
+        std::uint32_t slot_baud_rate{};
+    };
+
+    inline constexpr OWUARTTiming OW_UART_STANDARD_TIMING{.reset_baud_rate = 9600U,
+                                                          .reset_byte = 0xF0U,
+                                                          .slot_baud_rate = 115200U};
+
+    inline constexpr OWUARTTiming OW_UART_OVERDRIVE_TIMING{.reset_baud_rate = 115200U,
+                                                           .reset_byte = 0xC0U,
+                                                           .slot_baud_rate = 1000000U};
+
+    inline constexpr std::array<OWUARTTiming, 2UL> OW_UART_TIMINGS{OW_UART_STANDARD_TIMING, OW_UART_OVERDRIVE_TIMING};
+
+    struct OWTimerTiming {
+        std::uint32_t reset_low_us{};
+        std::uint32_t presence_sample_us{};
+        std::uint32_t reset_recovery_us{};
+        std::uint32_t write_one_low_us{};
+        std::uint32_t write_zero_low_us{};
+        std::uint32_t read_sample_us{};
+        std::uint32_t slot_us{};
+    };
+
+    // standard speed only: overdrive slots need 1-2 us compares, shorter than the compare interrupt latency
+    inline constexpr OWTimerTiming OW_TIMER_STANDARD_TIMING{.reset_low_us = 480U,
+                                                            .presence_sample_us = 70U,
+                                                            .reset_recovery_us = 410U,
+                                                            .write_one_low_us = 6U,
+                                                            .write_zero_low_us = 60U,
+                                                            .read_sample_us = 9U,
+                                                            .slot_us = 70U};
+
+    [[nodiscard]] constexpr std::uint8_t ow_crc8(std::span<std::uint8_t const> const data,
+                                                 std::uint8_t const init = 0x00U) noexcept
+    {
+        return CRCEngine<std::uint8_t, CRC8_MAXIM>::update(init, data);
+    }
+
+    [[nodiscard]] constexpr std::array<std::uint8_t, 8UL> ow_rom_to_bytes(std::uint64_t const rom) noexcept
+    {
+        std::array<std::uint8_t, 8UL> bytes{};
+        for (std::size_t index{}; index < bytes.size(); ++index) {
+            bytes[index] = static_cast<std::uint8_t>(rom >> (8UL * index));
+        }
+        return bytes;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t ow_bytes_to_rom(std::array<std::uint8_t, 8UL> const& bytes) noexcept
+    {
+        std::uint64_t rom{};
+        for (std::size_t index{}; index < bytes.size(); ++index) {
+            rom |= static_cast<std::uint64_t>(bytes[index]) << (8UL * index);
+        }
+        return rom;
+    }
+
+    [[nodiscard]] constexpr bool ow_is_rom_valid(std::uint64_t const rom) noexcept
+    {
+        auto const bytes{ow_rom_to_bytes(rom)};
+        return rom != 0ULL && ow_crc8(std::span<std::uint8_t const>{bytes.data(), 7UL}) == bytes[7];
+    }
+
+    struct OWBus {
+    public:
+        static constexpr std::size_t MAX_JOB_BYTES{24U};
+        static constexpr std::size_t MAX_ROMS{32U};
+
+        static constexpr std::uint8_t SEARCH_ROM{0xF0U};
+        static constexpr std::uint8_t ALARM_SEARCH{0xECU};
+        static constexpr std::uint8_t MATCH_ROM{0x55U};
+        static constexpr std::uint8_t SKIP_ROM{0xCCU};
+        static constexpr std::uint8_t OVERDRIVE_SKIP_ROM{0x3CU};
+        static constexpr std::uint8_t OVERDRIVE_MATCH_ROM{0x69U};
+
+        OWBus() noexcept = default;
+        explicit OWBus(UARTHandle const uart) noexcept;
+        OWBus(TIMHandle const timer, std::uint32_t const timer_channel, GPIO const dev_pin) noexcept;
+
+        OWBus(OWBus const& other) = delete;
+        OWBus(OWBus&& other) noexcept = delete;
+
+        OWBus& operator=(OWBus const& other) = delete;
+        OWBus& operator=(OWBus&& other) noexcept = delete;
+
+        ~OWBus() noexcept = default;
+
+        bool start_job(std::span<std::uint8_t const> const transmit, std::size_t const receive_size) noexcept;
+        bool start_job(std::span<std::uint8_t const> const transmit,
+                       std::size_t const receive_size,
+                       bool const reset) noexcept;
+        [[nodiscard]] bool is_busy() const noexcept;
+        HAL_StatusTypeDef wait() const noexcept;
+        void abort_job() noexcept;
+
+        HAL_StatusTypeDef transfer(std::span<std::uint8_t const> const transmit,
+                                   std::span<std::uint8_t> const receive) noexcept;
+        HAL_StatusTypeDef transfer_bits(std::span<bool const> const transmit, std::span<bool> const receive) noexcept;
+        HAL_StatusTypeDef broadcast(std::span<std::uint8_t const> const transmit) noexcept;
+        bool reset() noexcept;
+
+        bool set_speed(OWSpeed const speed) noexcept;
+        [[nodiscard]] OWSpeed speed() const noexcept;
+        [[nodiscard]] bool supports_overdrive() const noexcept;
+        [[nodiscard]] bool is_overdrive(std::uint64_t const rom) const noexcept;
+        void mark_overdrive(std::uint64_t const rom) noexcept;
+
+        bool search() noexcept;
+        std::size_t search_alarms(std::span<std::uint64_t> const alarm_roms) noexcept;
+        [[nodiscard]] bool is_searched() const noexcept;
+        [[nodiscard]] bool is_rom_present(std::uint64_t const rom) const noexcept;
+        [[nodiscard]] std::span<std::uint64_t const> roms() const noexcept;
+        [[nodiscard]] std::size_t rom_count() const noexcept;
+
+        [[nodiscard]] bool is_present() const noexcept;
+        [[nodiscard]] HAL_StatusTypeDef job_status() const noexcept;
+        [[nodiscard]] std::span<std::uint8_t const> received() const noexcept;
+
+        void uart_receive_complete_callback() noexcept;
+        void uart_error_callback() noexcept;
+        void timer_compare_callback() noexcept;
+
+    private:
+        static constexpr std::size_t MAX_JOB_SLOTS{8U * MAX_JOB_BYTES};
+        static constexpr std::uint8_t SLOT_ONE{0xFFU};
+        static constexpr std::uint8_t SLOT_ZERO{0x00U};
+        static constexpr std::uint32_t TIMEOUT{100U};
+
+        enum struct Backend : std::uint8_t {
+            NONE,
+            UART,
+            TIMER,
+        };
+
+        enum struct JobState : std::uint8_t {
+            IDLE,
+            RESET,
+            SLOTS,
+        };
+
+        enum struct TimerPhase : std::uint8_t {
+            RESET_LOW,
+            PRESENCE_SAMPLE,
+            RESET_RECOVERY,
+            SLOT_LOW,
+            SLOT_SAMPLE,
+            SLOT_RECOVERY,
+        };
+
+        static constexpr std::size_t ROM_BITS{64U};
+
+        bool start_slot_job(JobState const first_state) noexcept;
+        HAL_StatusTypeDef start_reset() noexcept;
+        HAL_StatusTypeDef start_slots() noexcept;
+        void finish_job(HAL_StatusTypeDef const status) noexcept;
+        void decode_slots() noexcept;
+
+        HAL_StatusTypeDef start_uart_reset() noexcept;
+        HAL_StatusTypeDef start_uart_slots() noexcept;
+        void set_uart_baud_rate(std::uint32_t const baud_rate) const noexcept;
+        std::uint32_t uart_clock_frequency() const noexcept;
+
+        std::size_t search_roms(std::uint8_t const command, std::span<std::uint64_t> const found) noexcept;
+
+        HAL_StatusTypeDef start_timer(TimerPhase const first_phase) noexcept;
+        HAL_StatusTypeDef start_timer_reset() noexcept;
+        HAL_StatusTypeDef start_timer_slots() noexcept;
+        void start_timer_slot() noexcept;
+        void schedule_timer_compare(std::uint32_t const delay_us) const noexcept;
+
+        Backend backend_{Backend::NONE};
+        OWSpeed speed_{OWSpeed::STANDARD};
+
+        UARTHandle uart_{nullptr};
+        OWUARTTiming uart_timing_{OW_UART_STANDARD_TIMING};
+
+        TIMHandle timer_{nullptr};
+        std::uint32_t timer_channel_{};
+        GPIO dev_pin_{};
+        OWTimerTiming timer_timing_{OW_TIMER_STANDARD_TIMING};
+        std::uint32_t timer_ticks_per_us_{};
+        TimerPhase volatile timer_phase_{TimerPhase::RESET_LOW};
+        std::size_t volatile slot_index_{};
+
+        std::array<std::uint8_t, MAX_JOB_SLOTS> transmit_slots_{};
+        std::array<std::uint8_t, MAX_JOB_SLOTS> receive_slots_{};
+        std::size_t slot_count_{};
+        std::uint8_t reset_echo_{};
+
+        std::array<std::uint8_t, MAX_JOB_BYTES> received_{};
+        std::size_t transmit_size_{};
+        std::size_t receive_size_{};
+
+        bool volatile present_{false};
+        JobState volatile job_state_{JobState::IDLE};
+        HAL_StatusTypeDef volatile job_status_{HAL_OK};
+
+        std::array<std::uint64_t, MAX_ROMS> roms_{};
+        std::size_t rom_count_{};
+        bool searched_{false};
+
+        std::array<std::uint64_t, MAX_ROMS> overdrive_roms_{};
+        std::size_t overdrive_count_{};
+        bool overdrive_all_{false};
+    };
+
+}; // namespace Utility
+
+#endif // OW_BUS_HPP
@@ -0,0 +1,206 @@
+#include "ow_conversion_scheduler.hpp"
+
+namespace Utility {
+
+    OWConversionScheduler::OWConversionScheduler(OWBus& ow_bus,
+                                                 std::uint32_t const conversion_time,
+                                                 bool const poll_read_slots) noexcept :
+        bus_{&ow_bus}, conversion_time_{conversion_time}, poll_read_slots_{poll_read_slots}
+    {}
+
+    std::optional<std::size_t> OWConversionScheduler::add_sensor(std::uint64_t const rom) noexcept
+    {
+        if (this->bus_ == nullptr || this->sensor_count_ == MAX_SENSORS ||
+            this->refresh_state_ != RefreshState::IDLE || !ow_is_rom_valid(rom) || !this->bus_->is_rom_present(rom)) {
+            return std::optional<std::size_t>{std::nullopt};
+        }
+
+        auto const sensor_index{this->sensor_count_++};
+        this->sensors_[sensor_index] = OWDevice{*this->bus_, rom};
+        return std::optional<std::size_t>{sensor_index};
+    }
+
+    std::size_t OWConversionScheduler::add_present_sensors(std::uint8_t const family_code) noexcept
+    {
+        if (this->bus_ == nullptr) {
+            return 0U;
+        }
+        if (!this->bus_->is_searched()) {
+            this->bus_->search();
+        }
+
+        std::size_t added{};
+        for (auto const rom : this->bus_->roms()) {
+            if (static_cast<std::uint8_t>(rom) == family_code && this->add_sensor(rom).has_value()) {
+                ++added;
+            }
+        }
+        return added;
+    }
+
+    bool OWConversionScheduler::start_refresh() noexcept
+    {
+        if (this->bus_ == nullptr || this->refresh_state_ != RefreshState::IDLE || this->sensor_count_ == 0U) {
+            return false;
+        }
+
+        this->refresh_status_ = HAL_BUSY;
+        this->invalid_count_ = 0U;
+        if (!this->bus_->set_speed(OWSpeed::STANDARD) ||
+            !this->bus_->start_job(std::array<std::uint8_t, 2UL>{OWBus::SKIP_ROM, CONVERT_T}, 0U)) {
+            this->finish_refresh(HAL_ERROR);
+            return false;
+        }
+        this->refresh_state_ = RefreshState::CONVERT_COMMAND;
+        return true;
+    }
+
+    bool OWConversionScheduler::poll_refresh() noexcept
+    {
+        switch (this->refresh_state_) {
+            case RefreshState::CONVERT_COMMAND:
+                if (this->bus_->is_busy()) {
+                    return false;
+                }
+                if (this->bus_->job_status() != HAL_OK) {
+                    this->finish_refresh(this->bus_->job_status());
+                    return true;
+                }
+                this->conversion_start_tick_ = HAL_GetTick();
+                this->refresh_state_ = RefreshState::CONVERTING;
+                return false;
+            case RefreshState::CONVERTING:
+                if (!this->is_conversion_done()) {
+                    return false;
+                }
+                this->refresh_state_ = RefreshState::READING;
+                if (this->start_next_reading(0U)) {
+                    return false;
+                }
+                this->publish_refresh();
+                return true;
+            case RefreshState::READING:
+                if (this->bus_->is_busy()) {
+                    return false;
+                }
+                this->store_scratchpad(this->reading_index_);
+                if (this->start_next_reading(this->reading_index_ + 1U)) {
+                    return false;
+                }
+                this->publish_refresh();
+                return true;
+            default:
+                return true;
+        }
+    }
+
+    HAL_StatusTypeDef OWConversionScheduler::refresh() noexcept
+    {
+        if (!this->start_refresh()) {
+            return this->refresh_status_;
+        }
+
+        auto const start_tick{HAL_GetTick()};
+        while (!this->poll_refresh()) {
+            if (HAL_GetTick() - start_tick > this->conversion_time_ + this->sensor_count_ * READ_TIMEOUT) {
+                this->bus_->abort_job();
+                this->finish_refresh(HAL_TIMEOUT);
+                return HAL_TIMEOUT;
+            }
+        }
+        return this->refresh_status_;
+    }
+
+    std::span<std::uint8_t const> OWConversionScheduler::get_scratchpad(std::size_t const sensor_index) const noexcept
+    {
+        if (sensor_index >= this->sensor_count_ || !this->front_valid_[sensor_index]) {
+            return std::span<std::uint8_t const>{};
+        }
+        return std::span<std::uint8_t const>{this->front_image_[sensor_index]};
+    }
+
+    std::optional<float> OWConversionScheduler::get_temperature(std::size_t const sensor_index) const noexcept
+    {
+        auto const scratchpad{this->get_scratchpad(sensor_index)};
+        if (scratchpad.empty()) {
+            return std::optional<float>{std::nullopt};
+        }
+        auto const raw{static_cast<std::int16_t>((scratchpad[1] << 8U) | scratchpad[0])};
+        return std::optional<float>{static_cast<float>(raw) / 16.0F};
+    }
+
+    std::size_t OWConversionScheduler::sensor_count() const noexcept
+    {
+        return this->sensor_count_;
+    }
+
+    HAL_StatusTypeDef OWConversionScheduler::refresh_status() const noexcept
+    {
+        return this->refresh_status_;
+    }
+
+    std::uint32_t OWConversionScheduler::crc_error_count() const noexcept
+    {
+        return this->crc_error_count_;
+    }
+
+    bool OWConversionScheduler::is_conversion_done() noexcept
+    {
+        if (HAL_GetTick() - this->conversion_start_tick_ >= this->conversion_time_) {
+            return true;
+        }
+        if (!this->poll_read_slots_) {
+            return false;
+        }
+
+        std::array<bool, 1UL> done{};
+        return this->bus_->transfer_bits(std::array<bool, 1UL>{true}, done) == HAL_OK && done[0];
+    }
+
+    bool OWConversionScheduler::start_reading(std::size_t const sensor_index) noexcept
+    {
+        this->reading_index_ = sensor_index;
+        return this->sensors_[sensor_index].start_read_bytes(READ_SCRATCHPAD, SCRATCHPAD_SIZE);
+    }
+
+    bool OWConversionScheduler::start_next_reading(std::size_t const sensor_index) noexcept
+    {
+        for (auto index{sensor_index}; index < this->sensor_count_; ++index) {
+            if (this->start_reading(index)) {
+                return true;
+            }
+            this->back_valid_[index] = false;
+            ++this->invalid_count_;
+        }
+        return false;
+    }
+
+    void OWConversionScheduler::store_scratchpad(std::size_t const sensor_index) noexcept
+    {
+        auto& scratchpad{this->back_image_[sensor_index]};
+        scratchpad = this->sensors_[sensor_index].get_read_bytes<SCRATCHPAD_SIZE>();
+
+        // nine zero bytes pass the CRC, but are what a shorted bus reads
+        auto const is_zero{std::ranges::all_of(scratchpad, [](std::uint8_t const byte) { return byte == 0x00U; })};
+        auto const valid{this->bus_->job_status() == HAL_OK && !is_zero && ow_crc8(scratchpad) == 0x00U};
+        this->back_valid_[sensor_index] = valid;
+        if (!valid) {
+            ++this->invalid_count_;
+            ++this->crc_error_count_;
+        }
+    }
+
+    void OWConversionScheduler::publish_refresh() noexcept
+    {
+        std::copy_n(this->back_image_.begin(), this->sensor_count_, this->front_image_.begin());
+        std::copy_n(this->back_valid_.begin(), this->sensor_count_, this->front_valid_.begin());
+        this->finish_refresh(this->invalid_count_ == 0U ? HAL_OK : HAL_ERROR);
+    }
+
+    void OWConversionScheduler::finish_refresh(HAL_StatusTypeDef const status) noexcept
+    {
+        this->refresh_status_ = status;
+        this->refresh_state_ = RefreshState::IDLE;
+    }
+
+}; // namespace Utility
@@ -0,0 +1,83 @@
+#ifndef OW_CONVERSION_SCHEDULER_HPP
+#define OW_CONVERSION_SCHEDULER_HPP
+
+#include "common.hpp"
+#include "ow_bus.hpp"
+#include "ow_device.hpp"
+#include "utility.hpp"
+#include <optional>
+#include <span>
+
+namespace Utility {
+
+    struct OWConversionScheduler {
+    public:
+        static constexpr std::size_t MAX_SENSORS{OWBus::MAX_ROMS};
+        static constexpr std::size_t SCRATCHPAD_SIZE{9U};
+        static constexpr std::uint32_t DEFAULT_CONVERSION_TIME{750U};
+
+        OWConversionScheduler() noexcept = default;
+        OWConversionScheduler(OWBus& ow_bus, std::uint32_t const conversion_time, bool const poll_read_slots) noexcept;
+
+        OWConversionScheduler(OWConversionScheduler const& other) = delete;
+        OWConversionScheduler(OWConversionScheduler&& other) noexcept = delete;
+
+        OWConversionScheduler& operator=(OWConversionScheduler const& other) = delete;
+        OWConversionScheduler& operator=(OWConversionScheduler&& other) noexcept = delete;
+
+        ~OWConversionScheduler() noexcept = default;
+
+        std::optional<std::size_t> add_sensor(std::uint64_t const rom) noexcept;
+        std::size_t add_present_sensors(std::uint8_t const family_code) noexcept;
+
+        bool start_refresh() noexcept;
+        [[nodiscard]] bool poll_refresh() noexcept;
+        HAL_StatusTypeDef refresh() noexcept;
+
+        [[nodiscard]] std::span<std::uint8_t const> get_scratchpad(std::size_t const sensor_index) const noexcept;
+        [[nodiscard]] std::optional<float> get_temperature(std::size_t const sensor_index) const noexcept;
+        [[nodiscard]] std::size_t sensor_count() const noexcept;
+        [[nodiscard]] HAL_StatusTypeDef refresh_status() const noexcept;
+        [[nodiscard]] std::uint32_t crc_error_count() const noexcept;
+
+    private:
+        static constexpr std::uint8_t CONVERT_T{0x44U};
+        static constexpr std::uint8_t READ_SCRATCHPAD{0xBEU};
+        static constexpr std::uint32_t READ_TIMEOUT{20U};
+
+        enum struct RefreshState : std::uint8_t {
+            IDLE,
+            CONVERT_COMMAND,
+            CONVERTING,
+            READING,
+        };
+
+        bool is_conversion_done() noexcept;
+        bool start_reading(std::size_t const sensor_index) noexcept;
+        bool start_next_reading(std::size_t const sensor_index) noexcept;
+        void store_scratchpad(std::size_t const sensor_index) noexcept;
+        void publish_refresh() noexcept;
+        void finish_refresh(HAL_StatusTypeDef const status) noexcept;
+
+        OWBus* bus_{nullptr};
+        std::uint32_t conversion_time_{DEFAULT_CONVERSION_TIME};
+        bool poll_read_slots_{false};
+
+        std::size_t sensor_count_{};
+        std::array<OWDevice, MAX_SENSORS> sensors_{};
+        std::array<std::array<std::uint8_t, SCRATCHPAD_SIZE>, MAX_SENSORS> back_image_{};
+        std::array<std::array<std::uint8_t, SCRATCHPAD_SIZE>, MAX_SENSORS> front_image_{};
+        std::array<bool, MAX_SENSORS> back_valid_{};
+        std::array<bool, MAX_SENSORS> front_valid_{};
+
+        RefreshState refresh_state_{RefreshState::IDLE};
+        std::uint32_t conversion_start_tick_{};
+        std::size_t reading_index_{};
+        std::size_t invalid_count_{};
+        HAL_StatusTypeDef refresh_status_{HAL_OK};
+        std::uint32_t crc_error_count_{};
+    };
+
+}; // namespace Utility
+
+#endif // OW_CONVERSION_SCHEDULER_HPP
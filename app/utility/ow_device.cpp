@@ -2,8 +2,14 @@
 
 namespace Utility {
 
-    OWDevice::OWDevice(TIMHandle const timer, GPIO const dev_pin, std::uint64_t const dev_address) noexcept :
-        timer_{timer}, dev_pin_{dev_pin}, dev_address_{dev_address}
+    OWDevice::OWDevice(OWBus& ow_bus, std::uint64_t const dev_address) noexcept :
+        bus_{&ow_bus}, dev_address_{dev_address}
+    {
+        this->initialize();
+    }
+
+    OWDevice::OWDevice(OWBus& ow_bus, std::uint64_t const dev_address, OWSpeed const speed) noexcept :
+        bus_{&ow_bus}, dev_address_{dev_address}, speed_{speed}
     {
         this->initialize();
     }
@@ -78,18 +84,145 @@ namespace Utility {
         return this->dev_address_;
     }
 
+    OWSpeed OWDevice::speed() const noexcept
+    {
+        return this->speed_;
+    }
+
+    bool OWDevice::start_read_bytes(std::uint8_t const reg_address, std::size_t const size) const noexcept
+    {
+        if (!this->initialized_) {
+            return false;
+        }
+        return this->start_transfer(std::array<std::uint8_t, 1UL>{reg_address}, size);
+    }
+
+    bool OWDevice::is_busy() const noexcept
+    {
+        return this->bus_ != nullptr && this->bus_->is_busy();
+    }
+
+    std::size_t OWDevice::header_size() const noexcept
+    {
+        if (this->speed_ == OWSpeed::OVERDRIVE && !this->bus_->is_overdrive(this->dev_address_)) {
+            return 0UL;
+        }
+        return this->dev_address_ == 0ULL ? 1UL : 1UL + sizeof(this->dev_address_);
+    }
+
+    std::size_t OWDevice::build_frame(std::span<std::uint8_t> const frame,
+                                      std::span<std::uint8_t const> const transmit) const noexcept
+    {
+        if (this->dev_address_ == 0ULL) {
+            if (1UL + transmit.size() > frame.size()) {
+                return 0UL;
+            }
+            frame[0] = OWBus::SKIP_ROM;
+            std::copy(transmit.begin(), transmit.end(), frame.begin() + 1UL);
+            return 1UL + transmit.size();
+        }
+
+        auto const rom{ow_rom_to_bytes(this->dev_address_)};
+        auto const header_size{1UL + rom.size()};
+        if (header_size + transmit.size() > frame.size()) {
+            return 0UL;
+        }
+        frame[0] = OWBus::MATCH_ROM;
+        std::copy(rom.begin(), rom.end(), frame.begin() + 1UL);
+        std::copy(transmit.begin(), transmit.end(), frame.begin() + header_size);
+        return header_size + transmit.size();
+    }
+
+    bool OWDevice::start_transfer(std::span<std::uint8_t const> const transmit,
+                                  std::size_t const receive_size) const noexcept
+    {
+        if (this->bus_ == nullptr) {
+            return false;
+        }
+
+        if (this->speed_ == OWSpeed::OVERDRIVE && !this->bus_->is_overdrive(this->dev_address_)) {
+            return this->enter_overdrive() && this->bus_->start_job(transmit, receive_size, false);
+        }
+        if (!this->bus_->set_speed(this->speed_)) {
+            return false;
+        }
+
+        std::array<std::uint8_t, OWBus::MAX_JOB_BYTES> frame{};
+        auto const frame_size{this->build_frame(frame, transmit)};
+        if (frame_size == 0UL) {
+            return false;
+        }
+        return this->bus_->start_job(std::span<std::uint8_t const>{frame.data(), frame_size}, receive_size);
+    }
+
+    bool OWDevice::transfer(std::span<std::uint8_t const> const transmit,
+                            std::span<std::uint8_t> const receive) const noexcept
+    {
+        if (!this->initialized_) {
+            return false;
+        }
+
+        auto capacity{OWBus::MAX_JOB_BYTES - this->header_size()};
+        std::size_t transmit_offset{};
+        std::size_t receive_offset{};
+        do {
+            auto const transmit_size{std::min(transmit.size() - transmit_offset, capacity)};
+            auto const receive_size{std::min(receive.size() - receive_offset, capacity - transmit_size)};
+            auto const chunk{transmit.subspan(transmit_offset, transmit_size)};
+
+            // only the first job resets and addresses the device
+            auto const started{transmit_offset + receive_offset == 0UL
+                                   ? this->start_transfer(chunk, receive_size)
+                                   : this->bus_->start_job(chunk, receive_size, false)};
+            if (!started || this->bus_->wait() != HAL_OK) {
+                return false;
+            }
+
+            auto const received{this->bus_->received()};
+            std::copy_n(received.begin(), std::min(received.size(), receive_size), receive.begin() + receive_offset);
+            transmit_offset += transmit_size;
+            receive_offset += receive_size;
+            capacity = OWBus::MAX_JOB_BYTES;
+        } while (transmit_offset < transmit.size() || receive_offset < receive.size());
+        return true;
+    }
+
+    bool OWDevice::enter_overdrive() const noexcept
+    {
+        if (!this->bus_->supports_overdrive() || !this->bus_->set_speed(OWSpeed::STANDARD)) {
+            return false;
+        }
+
+        auto const command{this->dev_address_ == 0ULL ? OWBus::OVERDRIVE_SKIP_ROM : OWBus::OVERDRIVE_MATCH_ROM};
+        if (this->bus_->transfer(std::array<std::uint8_t, 1UL>{command}, std::span<std::uint8_t>{}) != HAL_OK) {
+            return false;
+        }
+        this->bus_->set_speed(OWSpeed::OVERDRIVE);
+        if (command == OWBus::OVERDRIVE_MATCH_ROM &&
+            (!this->bus_->start_job(ow_rom_to_bytes(this->dev_address_), 0U, false) ||
+             this->bus_->wait() != HAL_OK)) {
+            return false;
+        }
+        this->bus_->mark_overdrive(this->dev_address_);
+        return true;
+    }
+
     void OWDevice::initialize() noexcept
     {
-        if (this->timer_ != nullptr) {
-            this->initialized_ = true;
+        if (this->bus_ != nullptr) {
+            if (this->speed_ == OWSpeed::OVERDRIVE && !this->bus_->supports_overdrive()) {
+                this->initialized_ = false;
+            } else if (this->dev_address_ != 0ULL && this->bus_->is_searched()) {
+                this->initialized_ = this->bus_->is_rom_present(this->dev_address_);
+            } else {
+                this->initialized_ = this->bus_->reset();
+            }
         }
     }
 
     void OWDevice::deinitialize() noexcept
     {
-        if (this->timer_ != nullptr) {
-            this->initialized_ = true;
-        }
+        this->initialized_ = false;
     }
 
 }; // namespace Utility
\ No newline at end of file
@@ -2,15 +2,17 @@
 #define OW_DEVICE_HPP
 
 #include "common.hpp"
-#include "gpio.hpp"
+#include "ow_bus.hpp"
 #include "utility.hpp"
+#include <span>
 
 namespace Utility {
 
     struct OWDevice {
     public:
         OWDevice() noexcept = default;
-        OWDevice(TIMHandle const timer, GPIO const dev_pin, std::uint64_t const dev_address) noexcept;
+        OWDevice(OWBus& ow_bus, std::uint64_t const dev_address) noexcept;
+        OWDevice(OWBus& ow_bus, std::uint64_t const dev_address, OWSpeed const speed) noexcept;
 
         OWDevice(OWDevice const& other) = delete;
         OWDevice(OWDevice&& other) noexcept = default;
@@ -69,40 +71,37 @@ namespace Utility {
         void write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
 
         std::uint64_t dev_address() const noexcept;
+        OWSpeed speed() const noexcept;
 
-    private:
-        static std::uint64_t get_counter_microseconds(TIMHandle const timer) noexcept
-        {
-            return 1000ULL * get_counter_miliseconds(timer);
-        }
+        // one addressed transaction of any length, split into bus jobs that continue without a reset;
+        // use it for commands with more than one address byte, such as TA1/TA2 memory functions
+        bool transfer(std::span<std::uint8_t const> const transmit,
+                      std::span<std::uint8_t> const receive) const noexcept;
 
-        static std::uint64_t get_counter_miliseconds(TIMHandle const timer) noexcept
-        {
-            return 1000ULL * __HAL_TIM_GetCounter(timer) / HAL_GetTickFreq() / __HAL_TIM_GetClockDivision(timer);
-        }
+        // a single bus job: 1 + size bytes must fit MAX_JOB_BYTES after the 1 or 9 byte ROM header
+        bool start_read_bytes(std::uint8_t const reg_address, std::size_t const size) const noexcept;
+        [[nodiscard]] bool is_busy() const noexcept;
 
-        static void delay_microseconds(TIMHandle const timer, std::uint64_t const delay) noexcept
-        {
-            if (timer != nullptr) {
-                HAL_TIM_Base_Start(timer);
-                while (get_counter_miliseconds(timer) < delay) {
-                }
-            }
-        }
+        template <std::size_t SIZE>
+        std::array<std::uint8_t, SIZE> get_read_bytes() const noexcept;
 
-        static constexpr std::uint32_t TIMEOUT{100U};
-        static constexpr std::uint32_t DELAY_80_US{80U};
-        static constexpr std::uint32_t DELAY_320_US{320U};
+    private:
+        std::size_t header_size() const noexcept;
+        std::size_t build_frame(std::span<std::uint8_t> const frame,
+                                std::span<std::uint8_t const> const transmit) const noexcept;
+        bool start_transfer(std::span<std::uint8_t const> const transmit,
+                            std::size_t const receive_size) const noexcept;
+        bool enter_overdrive() const noexcept;
 
         void initialize() noexcept;
         void deinitialize() noexcept;
 
         bool initialized_{false};
 
-        TIMHandle timer_{nullptr};
+        OWBus* bus_{nullptr};
 
-        GPIO dev_pin_{};
         std::uint64_t dev_address_{};
+        OWSpeed speed_{OWSpeed::STANDARD};
     };
 
     template <std::size_t SIZE>
@@ -121,6 +120,7 @@ namespace Utility {
     void OWDevice::transmit_bytes(std::array<std::uint8_t, SIZE> const& bytes) const noexcept
     {
         if (this->initialized_) {
+            this->transfer(bytes, std::span<std::uint8_t>{});
         }
     }
 
@@ -141,6 +141,7 @@ namespace Utility {
     {
         std::array<std::uint8_t, SIZE> receive{};
         if (this->initialized_) {
+            this->transfer(std::span<std::uint8_t const>{}, receive);
         }
         return receive;
     }
@@ -162,6 +163,7 @@ namespace Utility {
     {
         std::array<std::uint8_t, SIZE> read{};
         if (this->initialized_) {
+            this->transfer(std::array<std::uint8_t, 1UL>{reg_address}, read);
         }
         return read;
     }
@@ -185,9 +187,24 @@ namespace Utility {
                                std::array<std::uint8_t, SIZE> const& bytes) const noexcept
     {
         if (this->initialized_) {
+            std::array<std::uint8_t, 1UL + SIZE> write{};
+            write[0] = reg_address;
+            std::memcpy(write.data() + 1UL, bytes.data(), bytes.size());
+            this->transfer(write, std::span<std::uint8_t>{});
         }
     }
 
+    template <std::size_t SIZE>
+    std::array<std::uint8_t, SIZE> OWDevice::get_read_bytes() const noexcept
+    {
+        std::array<std::uint8_t, SIZE> read{};
+        if (this->bus_ != nullptr && !this->bus_->is_busy() && this->bus_->job_status() == HAL_OK) {
+            auto const received{this->bus_->received()};
+            std::copy_n(received.begin(), std::min(SIZE, received.size()), read.begin());
+        }
+        return read;
+    }
+
 }; // namespace Utility
 
 #endif // OW_DEVICE_HPP
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include "pwm_bridge.hpp"
+#include "timer_clock.hpp"
+
+namespace Utility {
+
+    PWMBridge::PWMBridge(TIMHandle const timer, PWMBridgeConfig const& config) noexcept :
+        timer_{timer}, config_{config}
+    {
+        this->initialize();
+    }
+
+    PWMBridge::~PWMBridge() noexcept
+    {
+        this->deinitialize();
+    }
+
+    void PWMBridge::set_duties_q15(std::array<std::uint16_t, PHASES> const& duties_q15) const noexcept
+    {
+        if (this->initialized_) {
+            auto* const instance{this->timer_->Instance};
+            instance->CR1 = instance->CR1 | TIM_CR1_UDIS;
+            instance->CCR1 = this->q15_to_compare(duties_q15[0]);
+            instance->CCR2 = this->q15_to_compare(duties_q15[1]);
+            instance->CCR3 = this->q15_to_compare(duties_q15[2]);
+            instance->CR1 = instance->CR1 & ~TIM_CR1_UDIS;
+        }
+    }
+
+    void PWMBridge::set_adc_trigger_q15(std::uint16_t const position_q15) const noexcept
+    {
+        if (this->initialized_) {
+            this->timer_->Instance->CCR4 = this->q15_to_trigger_compare(position_q15);
+        }
+    }
+
+    void PWMBridge::enable_outputs() const noexcept
+    {
+        if (this->initialized_) {
+            __HAL_TIM_MOE_ENABLE(this->timer_);
+        }
+    }
+
+    void PWMBridge::disable_outputs() const noexcept
+    {
+        if (this->initialized_) {
+            this->timer_->Instance->BDTR = this->timer_->Instance->BDTR & ~TIM_BDTR_MOE;
+        }
+    }
+
+    bool PWMBridge::is_break_active() const noexcept
+    {
+        return this->initialized_ && __HAL_TIM_GET_FLAG(this->timer_, TIM_FLAG_BREAK) != 0U;
+    }
+
+    void PWMBridge::clear_break() const noexcept
+    {
+        if (this->initialized_) {
+            __HAL_TIM_CLEAR_FLAG(this->timer_, TIM_FLAG_BREAK);
+        }
+    }
+
+    std::uint32_t PWMBridge::get_period() const noexcept
+    {
+        return this->timer_ != nullptr ? this->timer_->Instance->ARR : 0UL;
+    }
+
+    bool PWMBridge::is_initialized() const noexcept
+    {
+        return this->initialized_;
+    }
+
+    bool PWMBridge::configure_time_base() noexcept
+    {
+        auto const dead_time_divider{dead_time_clock_divider(this->dead_time_ticks())};
+        if (this->config_.frequency == 0UL || dead_time_divider == 0U) {
+            return false;
+        }
+
+        auto const counts{timer_clock_frequency(this->timer_->Instance) / (2UL * this->config_.frequency)};
+        auto const prescaler{counts > 0UL ? (counts - 1UL) / (MAX_PERIOD + 1UL) : 0UL};
+
+        this->timer_->Init.Prescaler = prescaler;
+        this->timer_->Init.Period = counts / (prescaler + 1UL);
+        this->timer_->Init.CounterMode = TIM_COUNTERMODE_CENTERALIGNED1;
+        this->timer_->Init.ClockDivision = dead_time_divider == 1U   ? TIM_CLOCKDIVISION_DIV1
+                                           : dead_time_divider == 2U ? TIM_CLOCKDIVISION_DIV2
+                                                                     : TIM_CLOCKDIVISION_DIV4;
+        this->timer_->Init.RepetitionCounter = 1UL;
+        this->timer_->Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+        return HAL_TIM_PWM_Init(this->timer_) == HAL_OK;
+    }
+
+    bool PWMBridge::configure_channels() noexcept
+    {
+        TIM_OC_InitTypeDef channel_config{.OCMode = TIM_OCMODE_PWM1,
+                                          .Pulse = 0UL,
+                                          .OCPolarity = TIM_OCPOLARITY_HIGH,
+                                          .OCNPolarity = TIM_OCNPOLARITY_HIGH,
+                                          .OCFastMode = TIM_OCFAST_DISABLE,
+                                          .OCIdleState = TIM_OCIDLESTATE_RESET,
+                                          .OCNIdleState = TIM_OCNIDLESTATE_RESET};
+        for (auto const channel : PHASE_CHANNELS) {
+            if (HAL_TIM_PWM_ConfigChannel(this->timer_, &channel_config, channel) != HAL_OK) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool PWMBridge::configure_break_dead_time() noexcept
+    {
+        // the dead-time generator counts tDTS = CKD * tCK_INT
+        auto const divider{1U << (this->timer_->Init.ClockDivision >> TIM_CR1_CKD_Pos)};
+        auto const dtg{dead_time_to_dtg((this->dead_time_ticks() + divider - 1U) / divider)};
+        if (!dtg.has_value()) {
+            return false;
+        }
+
+        TIM_BreakDeadTimeConfigTypeDef break_dead_time_config{
+            .OffStateRunMode = TIM_OSSR_ENABLE,
+            .OffStateIDLEMode = TIM_OSSI_ENABLE,
+            .LockLevel = TIM_LOCKLEVEL_OFF,
+            .DeadTime = *dtg,
+            .BreakState = static_cast<std::uint32_t>(this->config_.break_enable ? TIM_BREAK_ENABLE : TIM_BREAK_DISABLE),
+            .BreakPolarity = this->config_.break_polarity,
+            .BreakFilter = 0UL,
+            .Break2State = TIM_BREAK2_DISABLE,
+            .Break2Polarity = TIM_BREAK2POLARITY_HIGH,
+            .Break2Filter = 0UL,
+            .AutomaticOutput = TIM_AUTOMATICOUTPUT_DISABLE};
+        return HAL_TIMEx_ConfigBreakDeadTime(this->timer_, &break_dead_time_config) == HAL_OK;
+    }
+
+    bool PWMBridge::configure_adc_trigger() noexcept
+    {
+        TIM_OC_InitTypeDef trigger_config{.OCMode = TIM_OCMODE_PWM2,
+                                          .Pulse = this->q15_to_trigger_compare(this->config_.adc_trigger_q15),
+                                          .OCPolarity = TIM_OCPOLARITY_HIGH,
+                                          .OCNPolarity = TIM_OCNPOLARITY_HIGH,
+                                          .OCFastMode = TIM_OCFAST_DISABLE,
+                                          .OCIdleState = TIM_OCIDLESTATE_RESET,
+                                          .OCNIdleState = TIM_OCNIDLESTATE_RESET};
+        if (HAL_TIM_PWM_ConfigChannel(this->timer_, &trigger_config, TIM_CHANNEL_4) != HAL_OK) {
+            return false;
+        }
+
+        TIM_MasterConfigTypeDef master_config{.MasterOutputTrigger = TIM_TRGO_UPDATE,
+                                              .MasterOutputTrigger2 = TIM_TRGO2_OC4REF,
+                                              .MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE};
+        return HAL_TIMEx_MasterConfigSynchronization(this->timer_, &master_config) == HAL_OK;
+    }
+
+    std::uint32_t PWMBridge::dead_time_ticks() const noexcept
+    {
+        auto const timer_frequency{static_cast<std::uint64_t>(timer_clock_frequency(this->timer_->Instance))};
+        return static_cast<std::uint32_t>((this->config_.dead_time_ns * timer_frequency + 999999999ULL) /
+                                          1000000000ULL);
+    }
+
+    std::uint32_t PWMBridge::q15_to_compare(std::uint16_t const value_q15) const noexcept
+    {
+        return (this->timer_->Instance->ARR * std::min(value_q15, Q15_ONE)) >> 15U;
+    }
+
+    std::uint32_t PWMBridge::q15_to_trigger_compare(std::uint16_t const position_q15) const noexcept
+    {
+        return std::max(this->q15_to_compare(position_q15), std::uint32_t{1U});
+    }
+
+    void PWMBridge::initialize() noexcept
+    {
+        if (this->timer_ == nullptr || !IS_TIM_ADVANCED_INSTANCE(this->timer_->Instance)) {
+            return;
+        }
+
+        if (!this->configure_time_base() || !this->configure_channels() || !this->configure_break_dead_time() ||
+            !this->configure_adc_trigger()) {
+            return;
+        }
+
+        for (auto const channel : PHASE_CHANNELS) {
+            auto const started{HAL_TIM_PWM_Start(this->timer_, channel) == HAL_OK &&
+                               HAL_TIMEx_PWMN_Start(this->timer_, channel) == HAL_OK};
+            this->timer_->Instance->BDTR = this->timer_->Instance->BDTR & ~TIM_BDTR_MOE;
+            if (!started) {
+                return;
+            }
+        }
+        this->initialized_ = true;
+    }
+
+    void PWMBridge::deinitialize() noexcept
+    {
+        if (this->initialized_) {
+            for (auto const channel : PHASE_CHANNELS) {
+                HAL_TIMEx_PWMN_Stop(this->timer_, channel);
+                HAL_TIM_PWM_Stop(this->timer_, channel);
+            }
+            this->initialized_ = false;
+        }
+    }
+
+}; // namespace Utility
@@ -0,0 +1,133 @@
+#ifndef PWM_BRIDGE_HPP
+#define PWM_BRIDGE_HPP
+
+#include "common.hpp"
+#include "utility.hpp"
+#include <optional>
+
+namespace Utility {
+
+    struct PWMBridgeConfig {
+        std::uint32_t frequency{20000U};
+        std::uint32_t dead_time_ns{500U};
+        bool break_enable{true};
+        std::uint32_t break_polarity{TIM_BREAKPOLARITY_LOW};
+        std::uint16_t adc_trigger_q15{0x7FFFU};
+    };
+
+    inline constexpr std::uint32_t MAX_DEAD_TIME_TICKS{1008U};
+
+    // rounds up within each DTG band; a dead time above the DTG range has no encoding
+    [[nodiscard]] constexpr std::optional<std::uint8_t> dead_time_to_dtg(std::uint32_t const dead_time_ticks) noexcept
+    {
+        if (dead_time_ticks <= 127U) {
+            return static_cast<std::uint8_t>(dead_time_ticks);
+        }
+        if (dead_time_ticks <= 254U) {
+            return static_cast<std::uint8_t>(0x80U | ((dead_time_ticks + 1U) / 2U - 64U));
+        }
+        if (dead_time_ticks <= 504U) {
+            return static_cast<std::uint8_t>(0xC0U | ((dead_time_ticks + 7U) / 8U - 32U));
+        }
+        if (dead_time_ticks <= MAX_DEAD_TIME_TICKS) {
+            return static_cast<std::uint8_t>(0xE0U | ((dead_time_ticks + 15U) / 16U - 32U));
+        }
+        return std::optional<std::uint8_t>{std::nullopt};
+    }
+
+    // smallest tDTS/tCK_INT ratio (CKD) that fits the dead time into the DTG range, or 0 if none does
+    [[nodiscard]] constexpr std::uint32_t dead_time_clock_divider(std::uint32_t const dead_time_ticks) noexcept
+    {
+        for (std::uint32_t divider{1U}; divider <= 4U; divider *= 2U) {
+            if ((dead_time_ticks + divider - 1U) / divider <= MAX_DEAD_TIME_TICKS) {
+                return divider;
+            }
+        }
+        return 0U;
+    }
+
+    [[nodiscard]] constexpr std::uint32_t dtg_to_dead_time(std::uint8_t const dtg) noexcept
+    {
+        if ((dtg & 0x80U) == 0U) {
+            return dtg;
+        }
+        if ((dtg & 0xC0U) == 0x80U) {
+            return (64U + (dtg & 0x3FU)) * 2U;
+        }
+        if ((dtg & 0xE0U) == 0xC0U) {
+            return (32U + (dtg & 0x1FU)) * 8U;
+        }
+        return (32U + (dtg & 0x1FU)) * 16U;
+    }
+
+    static_assert(dead_time_to_dtg(127U) == 0x7FU);
+    static_assert(dead_time_to_dtg(128U) == 0x80U);
+    static_assert(dead_time_to_dtg(129U) == 0x81U);
+    static_assert(dead_time_to_dtg(254U) == 0xBFU);
+    static_assert(dead_time_to_dtg(255U) == 0xC0U);
+    static_assert(dead_time_to_dtg(504U) == 0xDFU);
+    static_assert(dead_time_to_dtg(505U) == 0xE0U);
+    static_assert(dead_time_to_dtg(511U) == 0xE0U);
+    static_assert(dead_time_to_dtg(1008U) == 0xFFU);
+    static_assert(!dead_time_to_dtg(1009U).has_value());
+    static_assert(dtg_to_dead_time(*dead_time_to_dtg(255U)) == 256U);
+    static_assert(dtg_to_dead_time(*dead_time_to_dtg(505U)) == 512U);
+    static_assert(dtg_to_dead_time(*dead_time_to_dtg(1001U)) == 1008U);
+    static_assert(dead_time_clock_divider(1008U) == 1U);
+    static_assert(dead_time_clock_divider(1009U) == 2U);
+    static_assert(dead_time_clock_divider(2017U) == 4U);
+    static_assert(dead_time_clock_divider(4032U) == 4U);
+    static_assert(dead_time_clock_divider(4033U) == 0U);
+
+    struct PWMBridge {
+    public:
+        static constexpr std::size_t PHASES{3U};
+
+        PWMBridge() noexcept = default;
+        PWMBridge(TIMHandle const timer, PWMBridgeConfig const& config) noexcept;
+
+        PWMBridge(PWMBridge const& other) = delete;
+        PWMBridge(PWMBridge&& other) noexcept = delete;
+
+        PWMBridge& operator=(PWMBridge const& other) = delete;
+        PWMBridge& operator=(PWMBridge&& other) noexcept = delete;
+
+        ~PWMBridge() noexcept;
+
+        void set_duties_q15(std::array<std::uint16_t, PHASES> const& duties_q15) const noexcept;
+        void set_adc_trigger_q15(std::uint16_t const position_q15) const noexcept;
+
+        void enable_outputs() const noexcept;
+        void disable_outputs() const noexcept;
+        [[nodiscard]] bool is_break_active() const noexcept;
+        void clear_break() const noexcept;
+
+        [[nodiscard]] std::uint32_t get_period() const noexcept;
+        [[nodiscard]] bool is_initialized() const noexcept;
+
+    private:
+        static constexpr std::uint16_t Q15_ONE{1U << 15U};
+        static constexpr std::uint32_t MAX_PERIOD{0xFFFFUL};
+        static constexpr std::array<std::uint32_t, PHASES> PHASE_CHANNELS{TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3};
+
+        bool configure_time_base() noexcept;
+        bool configure_channels() noexcept;
+        bool configure_break_dead_time() noexcept;
+        bool configure_adc_trigger() noexcept;
+
+        std::uint32_t dead_time_ticks() const noexcept;
+        std::uint32_t q15_to_compare(std::uint16_t const value_q15) const noexcept;
+        std::uint32_t q15_to_trigger_compare(std::uint16_t const position_q15) const noexcept;
+
+        void initialize() noexcept;
+        void deinitialize() noexcept;
+
+        bool initialized_{false};
+
+        TIMHandle timer_{nullptr};
+        PWMBridgeConfig config_{};
+    };
+
+}; // namespace Utility
+
+#endif // PWM_BRIDGE_HPP
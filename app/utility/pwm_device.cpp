@@ -1,12 +1,61 @@
 #include "pwm_device.hpp"
+#include "cycle_counter.hpp"
+#include "handle_registry.hpp"
+#include "timer_clock.hpp"
 
 namespace Utility {
 
+    namespace {
+
+        HandleRegistry<TIMHandle, PWMDevice, 4U> pwm_waveform_registry{};
+
+        volatile std::uint32_t* channel_compare_register(TIM_TypeDef* const instance,
+                                                         std::uint32_t const channel) noexcept
+        {
+            if (!IS_TIM_CCX_INSTANCE(instance, channel)) {
+                return nullptr;
+            }
+            switch (channel) {
+                case TIM_CHANNEL_1:
+                    return &instance->CCR1;
+                case TIM_CHANNEL_2:
+                    return &instance->CCR2;
+                case TIM_CHANNEL_3:
+                    return &instance->CCR3;
+                case TIM_CHANNEL_4:
+                    return &instance->CCR4;
+                case TIM_CHANNEL_5:
+                    return &instance->CCR5;
+                case TIM_CHANNEL_6:
+                    return &instance->CCR6;
+                default:
+                    return nullptr;
+            }
+        }
+
+        void waveform_half_transfer(DMA_HandleTypeDef* const dma) noexcept
+        {
+            auto const timer{static_cast<TIMHandle>(dma->Parent)};
+            if (auto* const pwm_device{pwm_waveform_registry.find(timer)}; pwm_device != nullptr) {
+                pwm_device->waveform_half_complete_callback();
+            }
+        }
+
+        void waveform_transfer(DMA_HandleTypeDef* const dma) noexcept
+        {
+            auto const timer{static_cast<TIMHandle>(dma->Parent)};
+            if (auto* const pwm_device{pwm_waveform_registry.find(timer)}; pwm_device != nullptr) {
+                pwm_device->waveform_complete_callback();
+            }
+        }
+
+    }; // namespace
+
     PWMDevice::PWMDevice(TIMHandle const timer,
                          std::uint16_t const channel_mask,
                          std::uint16_t const counter_period,
                          float const ref_voltage) noexcept :
-        timer_{timer}, channel_mask_{channel_mask}, min_raw_{0U}, max_raw_{counter_period}, ref_voltage_{ref_voltage}
+        timer_{timer}, channel_mask_{channel_mask}, scale_{0U, counter_period, ref_voltage}
     {
         this->initialize();
     }
@@ -16,7 +65,7 @@ namespace Utility {
                          std::uint16_t const min_raw,
                          std::uint16_t const max_raw,
                          float const ref_voltage) noexcept :
-        timer_{timer}, channel_mask_{channel_mask}, min_raw_{min_raw}, max_raw_{max_raw}, ref_voltage_{ref_voltage}
+        timer_{timer}, channel_mask_{channel_mask}, scale_{min_raw, max_raw, ref_voltage}
     {
         this->initialize();
     }
@@ -29,45 +78,211 @@ namespace Utility {
     void PWMDevice::set_compare_raw(std::uint16_t const raw) const noexcept
     {
         if (this->initialized_) {
-            printf("Raw: %d\n\r", raw);
-            __HAL_TIM_SetCompare(this->timer_, this->channel_mask_, raw);
+            *this->compare_register() = raw;
+        }
+    }
+
+    void PWMDevice::set_duty_q15(std::uint16_t const duty_q15) const noexcept
+    {
+        if (this->initialized_) {
+            *this->compare_register() = this->scale_.duty_q15_to_raw(duty_q15);
         }
     }
 
     void PWMDevice::set_compare_voltage(float const voltage) const noexcept
     {
-        this->set_compare_raw(this->voltage_to_raw(voltage));
+        this->set_compare_raw(this->scale_.voltage_to_raw(voltage));
     }
 
     void PWMDevice::set_compare_max() const noexcept
     {
-        this->set_compare_raw(this->max_raw_);
+        this->set_compare_raw(this->scale_.max_raw());
     }
 
     void PWMDevice::set_compare_min() const noexcept
     {
-        this->set_compare_raw(this->min_raw_);
+        this->set_compare_raw(this->scale_.min_raw());
+    }
+
+    std::uint32_t PWMDevice::measure_compare_voltage_cycles(float const voltage) const noexcept
+    {
+        cycle_counter_enable();
+        return cycle_counter_measure([this, voltage] { this->set_compare_voltage(voltage); });
+    }
+
+    std::uint32_t PWMDevice::measure_duty_q15_cycles(std::uint16_t const duty_q15) const noexcept
+    {
+        cycle_counter_enable();
+        return cycle_counter_measure([this, duty_q15] { this->set_duty_q15(duty_q15); });
     }
 
     float PWMDevice::get_ref_voltage() const noexcept
     {
-        return this->ref_voltage_;
+        return this->scale_.ref_voltage();
     }
 
-    void PWMDevice::set_frequency(std::uint32_t const frequency) noexcept
+    HAL_StatusTypeDef PWMDevice::start_waveform(std::span<std::uint16_t const> const table) noexcept
     {
-        this->deinitialize();
-        this->timer_->Init.Period = Utility::freq_hz_to_count(frequency,
-                                                              this->timer_->Init.Prescaler,
-                                                              80000000UL,
-                                                              this->timer_->Init.ClockDivision);
-        this->initialize();
+        this->waveform_buffer_ = std::span<std::uint16_t>{};
+        this->refill_callback_ = nullptr;
+        this->refill_context_ = nullptr;
+        return this->start_waveform_dma(table.data(), table.size());
+    }
+
+    HAL_StatusTypeDef PWMDevice::start_waveform(std::span<std::uint16_t> const buffer,
+                                                RefillCallback const refill_callback,
+                                                void* const context) noexcept
+    {
+        if (buffer.size() < 2U || buffer.size() % 2U != 0U) {
+            return HAL_ERROR;
+        }
+        this->waveform_buffer_ = buffer;
+        this->refill_callback_ = refill_callback;
+        this->refill_context_ = context;
+        return this->start_waveform_dma(buffer.data(), buffer.size());
+    }
+
+    void PWMDevice::stop_waveform() noexcept
+    {
+        if (this->waveform_running_) {
+            auto* const dma{this->timer_->hdma[TIM_DMA_ID_UPDATE]};
+            __HAL_TIM_DISABLE_DMA(this->timer_, TIM_DMA_UPDATE);
+            HAL_DMA_Abort(dma);
+            dma->XferHalfCpltCallback = this->saved_half_complete_callback_;
+            dma->XferCpltCallback = this->saved_complete_callback_;
+            pwm_waveform_registry.erase(this->timer_);
+            this->waveform_running_ = false;
+        }
+    }
+
+    bool PWMDevice::is_waveform_running() const noexcept
+    {
+        return this->waveform_running_;
+    }
+
+    void PWMDevice::waveform_half_complete_callback() noexcept
+    {
+        if (this->refill_callback_ != nullptr) {
+            this->refill_callback_(this->waveform_buffer_.first(this->waveform_buffer_.size() / 2U),
+                                   this->refill_context_);
+        }
+    }
+
+    void PWMDevice::waveform_complete_callback() noexcept
+    {
+        if (this->refill_callback_ != nullptr) {
+            this->refill_callback_(this->waveform_buffer_.last(this->waveform_buffer_.size() / 2U),
+                                   this->refill_context_);
+        }
+    }
+
+    HAL_StatusTypeDef PWMDevice::start_waveform_dma(std::uint16_t const* const data, std::size_t const size) noexcept
+    {
+        if (!this->initialized_ || this->waveform_running_ || data == nullptr || size == 0U) {
+            return HAL_ERROR;
+        }
+
+        auto* const dma{this->timer_->hdma[TIM_DMA_ID_UPDATE]};
+        if (dma == nullptr || dma->Init.Mode != DMA_CIRCULAR || !pwm_waveform_registry.insert(this->timer_, this)) {
+            return HAL_ERROR;
+        }
+
+        this->saved_half_complete_callback_ = dma->XferHalfCpltCallback;
+        this->saved_complete_callback_ = dma->XferCpltCallback;
+        dma->XferHalfCpltCallback = waveform_half_transfer;
+        dma->XferCpltCallback = waveform_transfer;
+        if (HAL_DMA_Start_IT(dma,
+                             static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(data)),
+                             static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(this->compare_register())),
+                             static_cast<std::uint32_t>(size)) != HAL_OK) {
+            dma->XferHalfCpltCallback = this->saved_half_complete_callback_;
+            dma->XferCpltCallback = this->saved_complete_callback_;
+            pwm_waveform_registry.erase(this->timer_);
+            return HAL_ERROR;
+        }
+        __HAL_TIM_ENABLE_DMA(this->timer_, TIM_DMA_UPDATE);
+        this->waveform_running_ = true;
+        return HAL_OK;
+    }
+
+    volatile std::uint32_t* PWMDevice::compare_register() const noexcept
+    {
+        return channel_compare_register(this->timer_->Instance, this->channel_mask_);
+    }
+
+    HAL_StatusTypeDef PWMDevice::set_frequency(std::uint32_t const frequency) noexcept
+    {
+        if (!this->initialized_ || frequency == 0UL) {
+            return HAL_ERROR;
+        }
+        if (this->waveform_running_ && this->waveform_buffer_.empty()) {
+            return HAL_BUSY;
+        }
+
+        auto* const instance{this->timer_->Instance};
+        auto const counter_cycles{(timer_clock_frequency(instance) + frequency / 2UL) / frequency};
+        if (counter_cycles < 2UL) {
+            return HAL_ERROR;
+        }
+
+        auto const prescaler{(counter_cycles - 1UL) / (MAX_PERIOD + 1UL)};
+        if (prescaler > MAX_PRESCALER) {
+            return HAL_ERROR;
+        }
+        auto const period{(counter_cycles + (prescaler + 1UL) / 2UL) / (prescaler + 1UL) - 1UL};
+
+        auto const old_counts{instance->ARR + 1UL};
+        auto const new_counts{period + 1UL};
+        auto const rescale_count{[old_counts, new_counts](std::uint32_t const count) {
+            return static_cast<std::uint32_t>(static_cast<std::uint64_t>(count) * new_counts / old_counts);
+        }};
+
+        instance->CR1 = instance->CR1 | TIM_CR1_UDIS;
+        instance->PSC = prescaler;
+        instance->ARR = period;
+        for (auto const channel : COMPARE_CHANNELS) {
+            auto* const compare{channel_compare_register(instance, channel)};
+            if (compare != nullptr && (instance->CCER & (TIM_CCER_CC1E << channel)) != 0UL) {
+                *compare = rescale_count(*compare);
+            }
+        }
+        if (this->waveform_running_) {
+            for (auto& sample : this->waveform_buffer_) {
+                sample = static_cast<std::uint16_t>(rescale_count(sample));
+            }
+        }
+        instance->CR1 = instance->CR1 & ~TIM_CR1_UDIS;
+
+        // min/max follow the configured fraction of the period, so repeated changes do not drift
+        auto const rescale_configured{[this, new_counts](std::uint16_t const raw) {
+            auto const count{static_cast<std::uint64_t>(raw) * new_counts / this->configured_counts_};
+            return static_cast<std::uint16_t>(std::min(count, std::uint64_t{0xFFFFU}));
+        }};
+        this->scale_ = PWMScale{rescale_configured(this->configured_scale_.min_raw()),
+                                rescale_configured(this->configured_scale_.max_raw()),
+                                this->configured_scale_.ref_voltage()};
+        this->timer_->Init.Prescaler = prescaler;
+        this->timer_->Init.Period = period;
+        return HAL_OK;
+    }
+
+    std::uint32_t PWMDevice::get_frequency() const noexcept
+    {
+        if (this->timer_ == nullptr) {
+            return 0UL;
+        }
+        auto const* const instance{this->timer_->Instance};
+        return timer_clock_frequency(instance) / (instance->PSC + 1UL) / (instance->ARR + 1UL);
     }
 
     void PWMDevice::initialize() noexcept
     {
-        if (this->timer_ != nullptr) {
+        if (this->timer_ != nullptr && this->compare_register() != nullptr) {
+            this->timer_->Instance->CR1 = this->timer_->Instance->CR1 | TIM_CR1_ARPE;
+            __HAL_TIM_ENABLE_OCxPRELOAD(this->timer_, this->channel_mask_);
             if (HAL_TIM_PWM_Start(this->timer_, this->channel_mask_) == HAL_OK) {
+                this->configured_scale_ = this->scale_;
+                this->configured_counts_ = this->timer_->Instance->ARR + 1UL;
                 this->initialized_ = true;
             }
         }
@@ -75,6 +290,7 @@ namespace Utility {
 
     void PWMDevice::deinitialize() noexcept
     {
+        this->stop_waveform();
         if (this->timer_ != nullptr) {
             if (HAL_TIM_PWM_Stop(this->timer_, this->channel_mask_) == HAL_OK) {
                 this->initialized_ = false;
@@ -82,14 +298,4 @@ namespace Utility {
         }
     }
 
-    std::uint16_t PWMDevice::voltage_to_raw(float const voltage) const noexcept
-    {
-        return Utility::rescale(voltage, 0.0F, this->ref_voltage_, this->min_raw_, this->max_raw_);
-    }
-
-    float PWMDevice::raw_to_voltage(std::uint16_t const raw) const noexcept
-    {
-        return Utility::rescale(raw, this->min_raw_, this->max_raw_, 0.0F, this->ref_voltage_);
-    }
-
 }; // namespace Utility
@@ -3,11 +3,102 @@
 
 #include "common.hpp"
 #include "utility.hpp"
+#include <span>
 
 namespace Utility {
 
+    // compare value <-> voltage and Q15 duty conversion over one [min_raw, max_raw] compare range
+    struct PWMScale {
+    public:
+        PWMScale() noexcept = default;
+        constexpr PWMScale(std::uint16_t const min_raw, std::uint16_t const max_raw, float const ref_voltage) noexcept;
+
+        [[nodiscard]] constexpr std::uint16_t voltage_to_raw(float const voltage) const noexcept;
+        [[nodiscard]] constexpr float raw_to_voltage(std::uint16_t const raw) const noexcept;
+        [[nodiscard]] constexpr std::uint16_t duty_q15_to_raw(std::uint16_t const duty_q15) const noexcept;
+
+        [[nodiscard]] constexpr std::uint16_t min_raw() const noexcept;
+        [[nodiscard]] constexpr std::uint16_t max_raw() const noexcept;
+        [[nodiscard]] constexpr float ref_voltage() const noexcept;
+
+    private:
+        static constexpr std::uint16_t Q15_ONE{1U << 15U};
+        static constexpr float Q16_ONE{65536.0F};
+
+        std::uint16_t min_raw_{};
+        std::uint16_t max_raw_{};
+        float ref_voltage_{};
+
+        std::uint32_t raw_span_{};
+        std::uint32_t ref_voltage_q16_{};
+        std::uint64_t voltage_scale_q16_{};
+        float raw_scale_{};
+    };
+
+    constexpr PWMScale::PWMScale(std::uint16_t const min_raw,
+                                 std::uint16_t const max_raw,
+                                 float const ref_voltage) noexcept :
+        min_raw_{min_raw}, max_raw_{max_raw}, ref_voltage_{ref_voltage}
+    {
+        this->raw_span_ = this->max_raw_ > this->min_raw_ ? this->max_raw_ - this->min_raw_ : 0UL;
+        this->ref_voltage_q16_ =
+            this->ref_voltage_ > 0.0F ? static_cast<std::uint32_t>(this->ref_voltage_ * Q16_ONE + 0.5F) : 0UL;
+        if (this->ref_voltage_q16_ == 0UL || this->raw_span_ == 0UL) {
+            this->ref_voltage_q16_ = 0UL;
+            return;
+        }
+
+        this->voltage_scale_q16_ =
+            ((static_cast<std::uint64_t>(this->raw_span_) << 32U) + this->ref_voltage_q16_ / 2UL) /
+            this->ref_voltage_q16_;
+        this->raw_scale_ = this->ref_voltage_ / static_cast<float>(this->raw_span_);
+    }
+
+    constexpr std::uint16_t PWMScale::voltage_to_raw(float const voltage) const noexcept
+    {
+        // also catches NaN
+        if (!(voltage > 0.0F)) {
+            return this->min_raw_;
+        }
+
+        auto const clamped_voltage{std::min(voltage, this->ref_voltage_)};
+        auto const voltage_q16{
+            std::min(static_cast<std::uint32_t>(clamped_voltage * Q16_ONE + 0.5F), this->ref_voltage_q16_)};
+        auto const offset{(voltage_q16 * this->voltage_scale_q16_ + (std::uint64_t{1U} << 31U)) >> 32U};
+        return static_cast<std::uint16_t>(this->min_raw_ + std::min(offset, std::uint64_t{this->raw_span_}));
+    }
+
+    constexpr float PWMScale::raw_to_voltage(std::uint16_t const raw) const noexcept
+    {
+        auto const offset{std::clamp(raw, this->min_raw_, this->max_raw_) - this->min_raw_};
+        return static_cast<float>(offset) * this->raw_scale_;
+    }
+
+    constexpr std::uint16_t PWMScale::duty_q15_to_raw(std::uint16_t const duty_q15) const noexcept
+    {
+        auto const duty{std::min(duty_q15, Q15_ONE)};
+        return static_cast<std::uint16_t>(this->min_raw_ + ((this->raw_span_ * duty) >> 15U));
+    }
+
+    constexpr std::uint16_t PWMScale::min_raw() const noexcept
+    {
+        return this->min_raw_;
+    }
+
+    constexpr std::uint16_t PWMScale::max_raw() const noexcept
+    {
+        return this->max_raw_;
+    }
+
+    constexpr float PWMScale::ref_voltage() const noexcept
+    {
+        return this->ref_voltage_;
+    }
+
     struct PWMDevice {
     public:
+        using RefillCallback = void (*)(std::span<std::uint16_t> const free_half, void* const context) noexcept;
+
         PWMDevice() noexcept = default;
 
         PWMDevice(TIMHandle const timer,
@@ -22,37 +113,69 @@ namespace Utility {
                   float const ref_voltage) noexcept;
 
         PWMDevice(PWMDevice const& other) noexcept = delete;
-        PWMDevice(PWMDevice&& other) noexcept = default;
+        PWMDevice(PWMDevice&& other) noexcept = delete;
 
         PWMDevice& operator=(PWMDevice const& other) noexcept = delete;
-        PWMDevice& operator=(PWMDevice&& other) noexcept = default;
+        PWMDevice& operator=(PWMDevice&& other) noexcept = delete;
 
         ~PWMDevice() noexcept;
 
-        void set_frequency(std::uint32_t const frequency) noexcept;
+        HAL_StatusTypeDef set_frequency(std::uint32_t const frequency) noexcept;
+        [[nodiscard]] std::uint32_t get_frequency() const noexcept;
 
         void set_compare_raw(std::uint16_t const raw) const noexcept;
+        void set_duty_q15(std::uint16_t const duty_q15) const noexcept;
         void set_compare_voltage(float const voltage) const noexcept;
         void set_compare_max() const noexcept;
         void set_compare_min() const noexcept;
+        [[nodiscard]] std::uint32_t measure_compare_voltage_cycles(float const voltage) const noexcept;
+        [[nodiscard]] std::uint32_t measure_duty_q15_cycles(std::uint16_t const duty_q15) const noexcept;
 
         [[nodiscard]] float get_ref_voltage() const noexcept;
 
+        HAL_StatusTypeDef start_waveform(std::span<std::uint16_t const> const table) noexcept;
+        HAL_StatusTypeDef start_waveform(std::span<std::uint16_t> const buffer,
+                                         RefillCallback const refill_callback,
+                                         void* const context) noexcept;
+        void stop_waveform() noexcept;
+        [[nodiscard]] bool is_waveform_running() const noexcept;
+
+        void waveform_half_complete_callback() noexcept;
+        void waveform_complete_callback() noexcept;
+
     private:
+        static constexpr std::uint32_t MAX_PERIOD{0xFFFFUL};
+        static constexpr std::uint32_t MAX_PRESCALER{0xFFFFUL};
+        static constexpr std::array<std::uint32_t, 6UL> COMPARE_CHANNELS{TIM_CHANNEL_1,
+                                                                         TIM_CHANNEL_2,
+                                                                         TIM_CHANNEL_3,
+                                                                         TIM_CHANNEL_4,
+                                                                         TIM_CHANNEL_5,
+                                                                         TIM_CHANNEL_6};
+
+        using DMACallback = void (*)(DMA_HandleTypeDef*);
+
+        HAL_StatusTypeDef start_waveform_dma(std::uint16_t const* const data, std::size_t const size) noexcept;
+        volatile std::uint32_t* compare_register() const noexcept;
+
         void initialize() noexcept;
         void deinitialize() noexcept;
 
-        std::uint16_t voltage_to_raw(float const voltage) const noexcept;
-        float raw_to_voltage(std::uint16_t const raw) const noexcept;
-
         bool initialized_{false};
 
         TIMHandle timer_{nullptr};
         std::uint16_t channel_mask_{};
 
-        std::uint16_t min_raw_{};
-        std::uint16_t max_raw_{};
-        float ref_voltage_{};
+        PWMScale scale_{};
+        PWMScale configured_scale_{};
+        std::uint32_t configured_counts_{};
+
+        std::span<std::uint16_t> waveform_buffer_{};
+        RefillCallback refill_callback_{nullptr};
+        void* refill_context_{nullptr};
+        DMACallback saved_half_complete_callback_{nullptr};
+        DMACallback saved_complete_callback_{nullptr};
+        bool waveform_running_{false};
     };
 
 }; // namespace Utility
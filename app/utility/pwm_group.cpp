@@ -0,0 +1,92 @@
+#include "pwm_group.hpp"
+
+namespace Utility {
+
+    PWMGroup::PWMGroup(TIMHandle const timer, std::size_t const channel_count) noexcept :
+        timer_{timer}, channel_count_{std::min(channel_count, MAX_CHANNELS)}
+    {
+        this->initialize();
+    }
+
+    PWMGroup::~PWMGroup() noexcept
+    {
+        this->deinitialize();
+    }
+
+    HAL_StatusTypeDef PWMGroup::set_compares_raw(std::span<std::uint16_t const> const raws) noexcept
+    {
+        if (!this->initialized_ || raws.size() != this->channel_count_) {
+            return HAL_ERROR;
+        }
+
+        HAL_TIM_DMABurst_WriteStop(this->timer_, TIM_DMA_UPDATE);
+        std::copy(raws.begin(), raws.end(), this->burst_buffer_.begin());
+        return this->start_burst();
+    }
+
+    HAL_StatusTypeDef PWMGroup::set_duty_cycles(std::span<float const> const duty_cycles) noexcept
+    {
+        if (!this->initialized_ || duty_cycles.size() != this->channel_count_) {
+            return HAL_ERROR;
+        }
+
+        auto const period{static_cast<float>(__HAL_TIM_GET_AUTORELOAD(this->timer_) + 1UL)};
+        HAL_TIM_DMABurst_WriteStop(this->timer_, TIM_DMA_UPDATE);
+        for (std::size_t index{}; index < this->channel_count_; ++index) {
+            auto const duty_cycle{std::clamp(duty_cycles[index], 0.0F, 1.0F)};
+            this->burst_buffer_[index] = static_cast<std::uint32_t>(duty_cycle * period);
+        }
+        return this->start_burst();
+    }
+
+    bool PWMGroup::is_update_pending() const noexcept
+    {
+        return this->initialized_ && this->timer_->hdma[TIM_DMA_ID_UPDATE]->State == HAL_DMA_STATE_BUSY;
+    }
+
+    std::size_t PWMGroup::channel_count() const noexcept
+    {
+        return this->channel_count_;
+    }
+
+    HAL_StatusTypeDef PWMGroup::start_burst() noexcept
+    {
+        auto const channel_count{static_cast<std::uint32_t>(this->channel_count_)};
+        return HAL_TIM_DMABurst_MultiWriteStart(this->timer_,
+                                                TIM_DMABASE_CCR1,
+                                                TIM_DMA_UPDATE,
+                                                this->burst_buffer_.data(),
+                                                (channel_count - 1U) << TIM_DCR_DBL_Pos,
+                                                channel_count);
+    }
+
+    void PWMGroup::initialize() noexcept
+    {
+        if (this->timer_ == nullptr || this->timer_->hdma[TIM_DMA_ID_UPDATE] == nullptr ||
+            this->channel_count_ == 0U) {
+            return;
+        }
+
+        this->timer_->Instance->CR1 = this->timer_->Instance->CR1 | TIM_CR1_ARPE;
+        for (std::size_t index{}; index < this->channel_count_; ++index) {
+            __HAL_TIM_ENABLE_OCxPRELOAD(this->timer_, CHANNELS[index]);
+            this->burst_buffer_[index] = __HAL_TIM_GET_COMPARE(this->timer_, CHANNELS[index]);
+            if (HAL_TIM_PWM_Start(this->timer_, CHANNELS[index]) != HAL_OK) {
+                return;
+            }
+        }
+        this->initialized_ = true;
+    }
+
+    void PWMGroup::deinitialize() noexcept
+    {
+        if (this->initialized_) {
+            HAL_TIM_DMABurst_WriteStop(this->timer_, TIM_DMA_UPDATE);
+            for (std::size_t index{}; index < this->channel_count_; ++index) {
+                HAL_TIM_PWM_Stop(this->timer_, CHANNELS[index]);
+            }
+            this->initialized_ = false;
+        }
+    }
+
+}; // namespace Utility
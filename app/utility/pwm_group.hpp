@@ -0,0 +1,52 @@
+#ifndef PWM_GROUP_HPP
+#define PWM_GROUP_HPP
+
+#include "common.hpp"
+#include "utility.hpp"
+#include <span>
+
+namespace Utility {
+
+    struct PWMGroup {
+    public:
+        static constexpr std::size_t MAX_CHANNELS{4U};
+
+        PWMGroup() noexcept = default;
+        PWMGroup(TIMHandle const timer, std::size_t const channel_count) noexcept;
+
+        PWMGroup(PWMGroup const& other) = delete;
+        PWMGroup(PWMGroup&& other) noexcept = delete;
+
+        PWMGroup& operator=(PWMGroup const& other) = delete;
+        PWMGroup& operator=(PWMGroup&& other) noexcept = delete;
+
+        ~PWMGroup() noexcept;
+
+        HAL_StatusTypeDef set_compares_raw(std::span<std::uint16_t const> const raws) noexcept;
+        HAL_StatusTypeDef set_duty_cycles(std::span<float const> const duty_cycles) noexcept;
+
+        [[nodiscard]] bool is_update_pending() const noexcept;
+        [[nodiscard]] std::size_t channel_count() const noexcept;
+
+    private:
+        static constexpr std::array<std::uint32_t, MAX_CHANNELS> CHANNELS{TIM_CHANNEL_1,
+                                                                          TIM_CHANNEL_2,
+                                                                          TIM_CHANNEL_3,
+                                                                          TIM_CHANNEL_4};
+
+        HAL_StatusTypeDef start_burst() noexcept;
+
+        void initialize() noexcept;
+        void deinitialize() noexcept;
+
+        bool initialized_{false};
+
+        TIMHandle timer_{nullptr};
+        std::size_t channel_count_{};
+
+        std::array<std::uint32_t, MAX_CHANNELS> burst_buffer_{};
+    };
+
+}; // namespace Utility
+
+#endif // PWM_GROUP_HPP
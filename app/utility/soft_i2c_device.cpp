@@ -0,0 +1,331 @@
+#include "soft_i2c_device.hpp"
+#include "cycle_counter.hpp"
+
+namespace Utility {
+
+    SoftI2CDevice::SoftI2CDevice(GPIO const scl_pin,
+                                 GPIO const sda_pin,
+                                 std::uint16_t const dev_address,
+                                 std::uint32_t const frequency) noexcept :
+        scl_port_{pin_to_port(scl_pin)},
+        sda_port_{pin_to_port(sda_pin)},
+        scl_mask_{pin_to_mask(scl_pin)},
+        sda_mask_{pin_to_mask(sda_pin)},
+        half_period_cycles_{frequency != 0U && frequency < max_frequency()
+                                ? (SystemCoreClock / frequency - BIT_OVERHEAD_CYCLES) / 2U
+                                : 0U},
+        dev_address_{dev_address}
+    {
+        this->initialize();
+    }
+
+    void SoftI2CDevice::transmit_byte(std::uint8_t const byte) const noexcept
+    {
+        this->transmit_bytes(std::array<std::uint8_t, 1UL>{byte});
+    }
+
+    std::uint8_t SoftI2CDevice::receive_byte() const noexcept
+    {
+        return this->receive_bytes<1UL>()[0];
+    }
+
+    std::uint8_t SoftI2CDevice::read_byte(std::uint8_t const reg_address) const noexcept
+    {
+        return this->read_bytes<1UL>(reg_address)[0];
+    }
+
+    void SoftI2CDevice::write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept
+    {
+        this->write_bytes(reg_address, std::array<std::uint8_t, 1UL>{byte});
+    }
+
+    void SoftI2CDevice::write_bytes(std::uint8_t const reg_address,
+                                    std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (this->initialized_) {
+            this->write(reg_address, bytes);
+        }
+    }
+
+    HAL_StatusTypeDef SoftI2CDevice::transmit(std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (!this->initialized_) {
+            return HAL_ERROR;
+        }
+
+        auto status{this->address(WRITE_BIT)};
+        if (status == HAL_OK) {
+            status = this->transmit_payload(bytes);
+        }
+        this->generate_stop();
+        return status;
+    }
+
+    HAL_StatusTypeDef SoftI2CDevice::receive(std::span<std::uint8_t> const bytes) const noexcept
+    {
+        if (!this->initialized_) {
+            return HAL_ERROR;
+        }
+
+        auto status{this->address(READ_BIT)};
+        if (status == HAL_OK) {
+            status = this->receive_payload(bytes);
+        }
+        this->generate_stop();
+        return status;
+    }
+
+    HAL_StatusTypeDef SoftI2CDevice::write(std::uint8_t const reg_address,
+                                           std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        if (!this->initialized_) {
+            return HAL_ERROR;
+        }
+
+        auto status{this->address(WRITE_BIT)};
+        if (status == HAL_OK) {
+            status = this->transmit_payload(std::span<std::uint8_t const>{&reg_address, 1UL});
+        }
+        if (status == HAL_OK) {
+            status = this->transmit_payload(bytes);
+        }
+        this->generate_stop();
+        return status;
+    }
+
+    HAL_StatusTypeDef SoftI2CDevice::read(std::uint8_t const reg_address,
+                                          std::span<std::uint8_t> const bytes) const noexcept
+    {
+        if (!this->initialized_) {
+            return HAL_ERROR;
+        }
+
+        auto status{this->address(WRITE_BIT)};
+        if (status == HAL_OK) {
+            status = this->transmit_payload(std::span<std::uint8_t const>{&reg_address, 1UL});
+        }
+        if (status == HAL_OK) {
+            status = this->address(READ_BIT);
+        }
+        if (status == HAL_OK) {
+            status = this->receive_payload(bytes);
+        }
+        this->generate_stop();
+        return status;
+    }
+
+    std::uint32_t SoftI2CDevice::measure_transmit_cycles(std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        // N payload bytes clock 9 * (N + 1) bits plus START and STOP (three half periods each), so
+        // (cycles - (18 * (N + 1) + 6) * half_period_cycles()) / (9 * (N + 1)) is the measured BIT_OVERHEAD_CYCLES
+        cycle_counter_enable();
+        return cycle_counter_measure([this, bytes] { static_cast<void>(this->transmit(bytes)); });
+    }
+
+    std::uint16_t SoftI2CDevice::dev_address() const noexcept
+    {
+        return this->dev_address_;
+    }
+
+    std::uint32_t SoftI2CDevice::half_period_cycles() const noexcept
+    {
+        return this->half_period_cycles_;
+    }
+
+    std::uint32_t SoftI2CDevice::max_frequency() noexcept
+    {
+        return SystemCoreClock / BIT_OVERHEAD_CYCLES;
+    }
+
+    bool SoftI2CDevice::is_initialized() const noexcept
+    {
+        return this->initialized_;
+    }
+
+    void SoftI2CDevice::scl_low() const noexcept
+    {
+        gpio_write_mask(this->scl_port_, 0U, this->scl_mask_);
+    }
+
+    bool SoftI2CDevice::scl_release() const noexcept
+    {
+        gpio_write_mask(this->scl_port_, this->scl_mask_, 0U);
+
+        auto const start_cycles{cycle_counter_get()};
+        auto const timeout_cycles{CLOCK_STRETCH_TIMEOUT_US * cycles_per_microsecond()};
+        while ((this->scl_port_->IDR & this->scl_mask_) == 0UL) {
+            if (cycle_counter_elapsed(start_cycles) > timeout_cycles) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void SoftI2CDevice::sda_low() const noexcept
+    {
+        gpio_write_mask(this->sda_port_, 0U, this->sda_mask_);
+    }
+
+    void SoftI2CDevice::sda_release() const noexcept
+    {
+        gpio_write_mask(this->sda_port_, this->sda_mask_, 0U);
+    }
+
+    bool SoftI2CDevice::sda_read() const noexcept
+    {
+        return (this->sda_port_->IDR & this->sda_mask_) != 0UL;
+    }
+
+    void SoftI2CDevice::half_period_delay() const noexcept
+    {
+        cycle_counter_delay_cycles(this->half_period_cycles_);
+    }
+
+    bool SoftI2CDevice::generate_start() const noexcept
+    {
+        this->sda_release();
+        this->half_period_delay();
+        if (!this->scl_release() || !this->sda_read()) {
+            return false;
+        }
+        this->half_period_delay();
+        this->sda_low();
+        this->half_period_delay();
+        this->scl_low();
+        return true;
+    }
+
+    void SoftI2CDevice::generate_stop() const noexcept
+    {
+        this->scl_low();
+        this->sda_low();
+        this->half_period_delay();
+        this->scl_release();
+        this->half_period_delay();
+        this->sda_release();
+        this->half_period_delay();
+    }
+
+    bool SoftI2CDevice::shift_out(std::uint8_t const byte) const noexcept
+    {
+        for (std::uint8_t mask{0x80U}; mask != 0U; mask >>= 1U) {
+            (byte & mask) != 0U ? this->sda_release() : this->sda_low();
+            this->half_period_delay();
+            if (!this->scl_release()) {
+                return false;
+            }
+            this->half_period_delay();
+            this->scl_low();
+        }
+
+        this->sda_release();
+        this->half_period_delay();
+        if (!this->scl_release()) {
+            return false;
+        }
+        this->half_period_delay();
+        auto const ack{!this->sda_read()};
+        this->scl_low();
+        return ack;
+    }
+
+    std::optional<std::uint8_t> SoftI2CDevice::shift_in(bool const ack) const noexcept
+    {
+        std::uint8_t byte{};
+        this->sda_release();
+        for (std::uint8_t bit{}; bit < 8U; ++bit) {
+            this->half_period_delay();
+            if (!this->scl_release()) {
+                return std::optional<std::uint8_t>{std::nullopt};
+            }
+            this->half_period_delay();
+            byte = static_cast<std::uint8_t>((byte << 1U) | (this->sda_read() ? 1U : 0U));
+            this->scl_low();
+        }
+
+        ack ? this->sda_low() : this->sda_release();
+        this->half_period_delay();
+        if (!this->scl_release()) {
+            return std::optional<std::uint8_t>{std::nullopt};
+        }
+        this->half_period_delay();
+        this->scl_low();
+        this->sda_release();
+        return std::optional<std::uint8_t>{byte};
+    }
+
+    HAL_StatusTypeDef SoftI2CDevice::address(std::uint8_t const direction_bit) const noexcept
+    {
+        if (!this->generate_start()) {
+            return HAL_BUSY;
+        }
+        auto const address_byte{static_cast<std::uint8_t>((this->dev_address_ << 1U) | direction_bit)};
+        return this->shift_out(address_byte) ? HAL_OK : HAL_ERROR;
+    }
+
+    HAL_StatusTypeDef SoftI2CDevice::transmit_payload(std::span<std::uint8_t const> const bytes) const noexcept
+    {
+        for (auto const byte : bytes) {
+            if (!this->shift_out(byte)) {
+                return HAL_ERROR;
+            }
+        }
+        return HAL_OK;
+    }
+
+    HAL_StatusTypeDef SoftI2CDevice::receive_payload(std::span<std::uint8_t> const bytes) const noexcept
+    {
+        for (std::size_t index{}; index < bytes.size(); ++index) {
+            auto const byte{this->shift_in(index + 1U < bytes.size())};
+            if (!byte.has_value()) {
+                return HAL_TIMEOUT;
+            }
+            bytes[index] = byte.value();
+        }
+        return HAL_OK;
+    }
+
+    void SoftI2CDevice::recover_bus() const noexcept
+    {
+        for (std::uint32_t pulse{}; pulse < RECOVERY_CLOCK_PULSES && !this->sda_read(); ++pulse) {
+            this->scl_low();
+            this->half_period_delay();
+            this->scl_release();
+            this->half_period_delay();
+        }
+        this->generate_stop();
+    }
+
+    void SoftI2CDevice::initialize() noexcept
+    {
+        if (this->scl_port_ == nullptr || this->sda_port_ == nullptr || this->half_period_cycles_ == 0UL) {
+            return;
+        }
+
+        cycle_counter_enable();
+
+        gpio_enable_port_clock(this->scl_port_);
+        gpio_enable_port_clock(this->sda_port_);
+
+        this->sda_release();
+        for (auto const& [port, mask] : {std::pair{this->scl_port_, this->scl_mask_},
+                                         std::pair{this->sda_port_, this->sda_mask_}}) {
+            gpio_write_mask(port, mask, 0U);
+            GPIO_InitTypeDef gpio_init{};
+            gpio_init.Pin = mask;
+            gpio_init.Mode = GPIO_MODE_OUTPUT_OD;
+            gpio_init.Pull = GPIO_NOPULL;
+            gpio_init.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+            HAL_GPIO_Init(port, &gpio_init);
+        }
+
+        if (!this->sda_read()) {
+            this->recover_bus();
+        }
+
+        auto const status{this->address(WRITE_BIT)};
+        this->generate_stop();
+        this->initialized_ = status == HAL_OK;
+    }
+
+}; // namespace Utility
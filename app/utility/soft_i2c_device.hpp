@@ -0,0 +1,143 @@
+#ifndef SOFT_I2C_DEVICE_HPP
+#define SOFT_I2C_DEVICE_HPP
+
+#include "common.hpp"
+#include "gpio.hpp"
+#include "utility.hpp"
+#include <optional>
+#include <span>
+
+namespace Utility {
+
+    struct SoftI2CDevice {
+    public:
+        static constexpr std::uint32_t DEFAULT_FREQUENCY{100000U};
+
+        SoftI2CDevice() noexcept = default;
+        SoftI2CDevice(GPIO const scl_pin,
+                      GPIO const sda_pin,
+                      std::uint16_t const dev_address,
+                      std::uint32_t const frequency = DEFAULT_FREQUENCY) noexcept;
+
+        SoftI2CDevice(SoftI2CDevice const& other) = delete;
+        SoftI2CDevice(SoftI2CDevice&& other) noexcept = default;
+
+        SoftI2CDevice& operator=(SoftI2CDevice const& other) = delete;
+        SoftI2CDevice& operator=(SoftI2CDevice&& other) noexcept = default;
+
+        ~SoftI2CDevice() noexcept = default;
+
+        template <std::size_t SIZE>
+        void transmit_bytes(std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
+        void transmit_byte(std::uint8_t const byte) const noexcept;
+
+        template <std::size_t SIZE>
+        std::array<std::uint8_t, SIZE> receive_bytes() const noexcept;
+        std::uint8_t receive_byte() const noexcept;
+
+        template <std::size_t SIZE>
+        std::array<std::uint8_t, SIZE> read_bytes(std::uint8_t const reg_address) const noexcept;
+        std::uint8_t read_byte(std::uint8_t const reg_address) const noexcept;
+
+        template <std::size_t SIZE>
+        void write_bytes(std::uint8_t const reg_address, std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
+        void write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
+
+        void write_bytes(std::uint8_t const reg_address, std::span<std::uint8_t const> const bytes) const noexcept;
+
+        HAL_StatusTypeDef transmit(std::span<std::uint8_t const> const bytes) const noexcept;
+        HAL_StatusTypeDef receive(std::span<std::uint8_t> const bytes) const noexcept;
+        HAL_StatusTypeDef write(std::uint8_t const reg_address,
+                                std::span<std::uint8_t const> const bytes) const noexcept;
+        HAL_StatusTypeDef read(std::uint8_t const reg_address, std::span<std::uint8_t> const bytes) const noexcept;
+
+        [[nodiscard]] std::uint32_t measure_transmit_cycles(std::span<std::uint8_t const> const bytes) const noexcept;
+
+        std::uint16_t dev_address() const noexcept;
+        [[nodiscard]] std::uint32_t half_period_cycles() const noexcept;
+        [[nodiscard]] bool is_initialized() const noexcept;
+
+        // fixed cost of one clocked bit besides the two half-period delays: two BSRR stores, SCL release with
+        // the stretch-timeout setup and IDR poll, and two DWT delay entries with up to one loop pass of overshoot,
+        // counted from the Cortex-M4 -O2 sequence; at 80 MHz this caps SCL at 80 MHz / 48 ~= 1.6 MHz with no
+        // delay at all, so Fm+ (1 MHz, 16 cycle half period) is the fastest reliable setting there
+        static constexpr std::uint32_t BIT_OVERHEAD_CYCLES{48U};
+
+        [[nodiscard]] static std::uint32_t max_frequency() noexcept;
+
+    private:
+        static constexpr std::uint32_t CLOCK_STRETCH_TIMEOUT_US{1000U};
+        static constexpr std::uint32_t RECOVERY_CLOCK_PULSES{9U};
+        static constexpr std::uint8_t WRITE_BIT{0x00U};
+        static constexpr std::uint8_t READ_BIT{0x01U};
+
+        void scl_low() const noexcept;
+        bool scl_release() const noexcept;
+        void sda_low() const noexcept;
+        void sda_release() const noexcept;
+        [[nodiscard]] bool sda_read() const noexcept;
+        void half_period_delay() const noexcept;
+
+        bool generate_start() const noexcept;
+        void generate_stop() const noexcept;
+        bool shift_out(std::uint8_t const byte) const noexcept;
+        std::optional<std::uint8_t> shift_in(bool const ack) const noexcept;
+
+        HAL_StatusTypeDef address(std::uint8_t const direction_bit) const noexcept;
+        HAL_StatusTypeDef transmit_payload(std::span<std::uint8_t const> const bytes) const noexcept;
+        HAL_StatusTypeDef receive_payload(std::span<std::uint8_t> const bytes) const noexcept;
+
+        void recover_bus() const noexcept;
+        void initialize() noexcept;
+
+        bool initialized_{false};
+
+        GPIO_TypeDef* scl_port_{nullptr};
+        GPIO_TypeDef* sda_port_{nullptr};
+        std::uint16_t scl_mask_{};
+        std::uint16_t sda_mask_{};
+        std::uint32_t half_period_cycles_{};
+
+        std::uint16_t dev_address_{};
+    };
+
+    template <std::size_t SIZE>
+    void SoftI2CDevice::transmit_bytes(std::array<std::uint8_t, SIZE> const& bytes) const noexcept
+    {
+        if (this->initialized_) {
+            this->transmit(bytes);
+        }
+    }
+
+    template <std::size_t SIZE>
+    std::array<std::uint8_t, SIZE> SoftI2CDevice::receive_bytes() const noexcept
+    {
+        std::array<std::uint8_t, SIZE> receive{};
+        if (this->initialized_) {
+            this->receive(receive);
+        }
+        return receive;
+    }
+
+    template <std::size_t SIZE>
+    std::array<std::uint8_t, SIZE> SoftI2CDevice::read_bytes(std::uint8_t const reg_address) const noexcept
+    {
+        std::array<std::uint8_t, SIZE> read{};
+        if (this->initialized_) {
+            this->read(reg_address, read);
+        }
+        return read;
+    }
+
+    template <std::size_t SIZE>
+    void SoftI2CDevice::write_bytes(std::uint8_t const reg_address,
+                                    std::array<std::uint8_t, SIZE> const& bytes) const noexcept
+    {
+        if (this->initialized_) {
+            this->write(reg_address, bytes);
+        }
+    }
+
+}; // namespace Utility
+
+#endif // SOFT_I2C_DEVICE_HPP
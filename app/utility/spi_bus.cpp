@@ -0,0 +1,242 @@
+#include "spi_bus.hpp"
+#include "handle_registry.hpp"
+
+namespace Utility {
+
+    namespace {
+
+        HandleRegistry<SPIHandle, SPIBus, 3U> spi_bus_registry{};
+
+    }; // namespace
+
+    SPIBus::SPIBus(SPIHandle const spi_bus) noexcept : spi_bus_{spi_bus}
+    {}
+
+    bool SPIBus::enqueue(SPIFrame const& frame) noexcept
+    {
+        if (this->spi_bus_ == nullptr || frame.transmit.empty() || frame.transmit.size() > MAX_FRAME_SIZE ||
+            (!frame.receive.empty() && frame.receive.size() != frame.transmit.size())) {
+            return false;
+        }
+
+        auto const primask{__get_PRIMASK()};
+        __disable_irq();
+
+        if (this->frame_count_ == MAX_QUEUED_FRAMES) {
+            __set_PRIMASK(primask);
+            return false;
+        }
+
+        this->frames_[(this->frame_head_ + this->frame_count_) % MAX_QUEUED_FRAMES] = frame;
+        this->frame_count_ = this->frame_count_ + 1U;
+
+        auto const start{!this->transferring_ && !this->locked_};
+        if (start) {
+            spi_bus_registry.insert(this->spi_bus_, this);
+            this->status_ = HAL_BUSY;
+            this->transferring_ = true;
+        }
+
+        __set_PRIMASK(primask);
+
+        if (start) {
+            this->start_queue();
+        }
+        return true;
+    }
+
+    bool SPIBus::is_busy() const noexcept
+    {
+        return this->transferring_;
+    }
+
+    HAL_StatusTypeDef SPIBus::wait() const noexcept
+    {
+        auto const start_tick{HAL_GetTick()};
+        while (this->is_busy()) {
+            if (HAL_GetTick() - start_tick > TIMEOUT) {
+                return HAL_TIMEOUT;
+            }
+        }
+        return this->status_;
+    }
+
+    void SPIBus::configure(SPIConfig const& config) noexcept
+    {
+        if (this->spi_bus_ == nullptr) {
+            return;
+        }
+
+        auto* const instance{this->spi_bus_->Instance};
+        auto const cr1_bits{config.cr1_bits()};
+        if (!this->configured_ || cr1_bits != this->active_cr1_bits_) {
+            instance->CR1 = (instance->CR1 & ~(SPI_CR1_SPE | SPIConfig::CR1_MASK)) | cr1_bits;
+
+            this->spi_bus_->Init.CLKPolarity = config.clock_polarity;
+            this->spi_bus_->Init.CLKPhase = config.clock_phase;
+            this->spi_bus_->Init.BaudRatePrescaler = config.baud_rate_prescaler;
+            this->spi_bus_->Init.FirstBit = config.first_bit;
+
+            this->active_cr1_bits_ = cr1_bits;
+            this->configured_ = true;
+            ++this->reconfiguration_count_;
+        }
+
+        instance->CR1 = instance->CR1 | SPI_CR1_SPE;
+    }
+
+    SPIConfig SPIBus::get_config() const noexcept
+    {
+        if (this->spi_bus_ == nullptr) {
+            return SPIConfig{};
+        }
+        return SPIConfig{.clock_polarity = this->spi_bus_->Init.CLKPolarity,
+                         .clock_phase = this->spi_bus_->Init.CLKPhase,
+                         .baud_rate_prescaler = this->spi_bus_->Init.BaudRatePrescaler,
+                         .first_bit = this->spi_bus_->Init.FirstBit};
+    }
+
+    std::uint32_t SPIBus::reconfiguration_count() const noexcept
+    {
+        return this->reconfiguration_count_;
+    }
+
+    void SPIBus::lock() noexcept
+    {
+        while (!this->try_lock()) {
+            __WFE();
+        }
+    }
+
+    bool SPIBus::try_lock() noexcept
+    {
+        auto const primask{__get_PRIMASK()};
+        __disable_irq();
+
+        auto const acquired{!this->locked_};
+        this->locked_ = true;
+
+        __set_PRIMASK(primask);
+        return acquired;
+    }
+
+    void SPIBus::unlock() noexcept
+    {
+        auto const primask{__get_PRIMASK()};
+        __disable_irq();
+
+        this->locked_ = false;
+        __SEV();
+
+        auto const start{!this->transferring_ && this->frame_count_ > 0U};
+        if (start) {
+            spi_bus_registry.insert(this->spi_bus_, this);
+            this->status_ = HAL_BUSY;
+            this->transferring_ = true;
+        }
+
+        __set_PRIMASK(primask);
+
+        if (start) {
+            this->start_queue();
+        }
+    }
+
+    void SPIBus::transfer_complete_callback() noexcept
+    {
+        this->complete_frame(HAL_OK);
+    }
+
+    void SPIBus::error_callback() noexcept
+    {
+        this->complete_frame(HAL_ERROR);
+    }
+
+    SPIHandle SPIBus::spi_bus() const noexcept
+    {
+        return this->spi_bus_;
+    }
+
+    HAL_StatusTypeDef SPIBus::start_frame() noexcept
+    {
+        auto const& frame{this->frames_[this->frame_head_]};
+        auto const size{static_cast<std::uint16_t>(frame.transmit.size())};
+
+        this->configure(frame.config);
+        gpio_write_pin(frame.chip_select, GPIO_PIN_RESET);
+
+        if (frame.receive.empty()) {
+            if (this->spi_bus_->hdmatx != nullptr) {
+                return HAL_SPI_Transmit_DMA(this->spi_bus_, frame.transmit.data(), size);
+            }
+            return HAL_SPI_Transmit_IT(this->spi_bus_, frame.transmit.data(), size);
+        }
+
+        if (this->spi_bus_->hdmatx != nullptr && this->spi_bus_->hdmarx != nullptr) {
+            return HAL_SPI_TransmitReceive_DMA(this->spi_bus_, frame.transmit.data(), frame.receive.data(), size);
+        }
+        return HAL_SPI_TransmitReceive_IT(this->spi_bus_, frame.transmit.data(), frame.receive.data(), size);
+    }
+
+    void SPIBus::start_queue() noexcept
+    {
+        while (this->frame_count_ > 0U && !this->locked_) {
+            if (this->start_frame() == HAL_OK) {
+                return;
+            }
+            gpio_write_pin(this->frames_[this->frame_head_].chip_select, GPIO_PIN_SET);
+            this->status_ = HAL_ERROR;
+            this->frame_head_ = (this->frame_head_ + 1U) % MAX_QUEUED_FRAMES;
+            this->frame_count_ = this->frame_count_ - 1U;
+        }
+
+        if (this->status_ == HAL_BUSY) {
+            this->status_ = HAL_OK;
+        }
+        this->transferring_ = false;
+        spi_bus_registry.erase(this->spi_bus_);
+    }
+
+    void SPIBus::complete_frame(HAL_StatusTypeDef const status) noexcept
+    {
+        if (!this->transferring_) {
+            return;
+        }
+
+        gpio_write_pin(this->frames_[this->frame_head_].chip_select, GPIO_PIN_SET);
+
+        if (status != HAL_OK) {
+            this->status_ = status;
+        }
+
+        this->frame_head_ = (this->frame_head_ + 1U) % MAX_QUEUED_FRAMES;
+        this->frame_count_ = this->frame_count_ - 1U;
+
+        this->start_queue();
+    }
+
+}; // namespace Utility
+
+extern "C" {
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi)
+{
+    if (auto* const spi_bus{Utility::spi_bus_registry.find(hspi)}; spi_bus != nullptr) {
+        spi_bus->transfer_complete_callback();
+    }
+}
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* hspi)
+{
+    if (auto* const spi_bus{Utility::spi_bus_registry.find(hspi)}; spi_bus != nullptr) {
+        spi_bus->transfer_complete_callback();
+    }
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi)
+{
+    if (auto* const spi_bus{Utility::spi_bus_registry.find(hspi)}; spi_bus != nullptr) {
+        spi_bus->error_callback();
+    }
+}
+}
@@ -0,0 +1,103 @@
+#ifndef SPI_BUS_HPP
+#define SPI_BUS_HPP
+
+#include "common.hpp"
+#include "gpio.hpp"
+#include "utility.hpp"
+#include <span>
+
+namespace Utility {
+
+    struct SPIConfig {
+        std::uint32_t clock_polarity{SPI_POLARITY_LOW};
+        std::uint32_t clock_phase{SPI_PHASE_1EDGE};
+        std::uint32_t baud_rate_prescaler{SPI_BAUDRATEPRESCALER_2};
+        std::uint32_t first_bit{SPI_FIRSTBIT_MSB};
+
+        static constexpr std::uint32_t CR1_MASK{SPI_CR1_CPOL | SPI_CR1_CPHA | SPI_CR1_BR | SPI_CR1_LSBFIRST};
+
+        [[nodiscard]] constexpr std::uint32_t cr1_bits() const noexcept
+        {
+            return (this->clock_polarity | this->clock_phase | this->baud_rate_prescaler | this->first_bit) & CR1_MASK;
+        }
+    };
+
+    struct SPIFrame {
+        SPIConfig config{};
+        GPIO chip_select{};
+        std::span<std::uint8_t const> transmit{};
+        std::span<std::uint8_t> receive{};
+    };
+
+    template <std::size_t SIZE>
+    struct SPIFrameBuffer {
+        std::array<std::uint8_t, 1UL + SIZE> transmit{};
+        std::array<std::uint8_t, 1UL + SIZE> receive{};
+
+        [[nodiscard]] std::array<std::uint8_t, SIZE> payload() const noexcept
+        {
+            std::array<std::uint8_t, SIZE> payload{};
+            std::memcpy(payload.data(), this->receive.data() + 1UL, SIZE);
+            return payload;
+        }
+    };
+
+    struct SPIBus {
+    public:
+        SPIBus() noexcept = default;
+        explicit SPIBus(SPIHandle const spi_bus) noexcept;
+
+        SPIBus(SPIBus const& other) = delete;
+        SPIBus(SPIBus&& other) noexcept = delete;
+
+        SPIBus& operator=(SPIBus const& other) = delete;
+        SPIBus& operator=(SPIBus&& other) noexcept = delete;
+
+        ~SPIBus() noexcept = default;
+
+        bool enqueue(SPIFrame const& frame) noexcept;
+        [[nodiscard]] bool is_busy() const noexcept;
+        HAL_StatusTypeDef wait() const noexcept;
+
+        void configure(SPIConfig const& config) noexcept;
+        [[nodiscard]] SPIConfig get_config() const noexcept;
+        [[nodiscard]] std::uint32_t reconfiguration_count() const noexcept;
+
+        // blocks in WFE until unlock(); not for interrupts that can preempt the holder
+        void lock() noexcept;
+        [[nodiscard]] bool try_lock() noexcept;
+        void unlock() noexcept;
+
+        void transfer_complete_callback() noexcept;
+        void error_callback() noexcept;
+
+        [[nodiscard]] SPIHandle spi_bus() const noexcept;
+
+    private:
+        static constexpr std::size_t MAX_QUEUED_FRAMES{8U};
+        static constexpr std::size_t MAX_FRAME_SIZE{0xFFFFU};
+        static constexpr std::uint32_t TIMEOUT{100U};
+
+        HAL_StatusTypeDef start_frame() noexcept;
+        void start_queue() noexcept;
+        void complete_frame(HAL_StatusTypeDef const status) noexcept;
+
+        SPIHandle spi_bus_{nullptr};
+
+        std::array<SPIFrame, MAX_QUEUED_FRAMES> frames_{};
+        std::size_t frame_head_{};
+        std::size_t volatile frame_count_{};
+
+        HAL_StatusTypeDef volatile status_{HAL_OK};
+        bool volatile transferring_{false};
+
+        bool configured_{false};
+        std::uint32_t active_cr1_bits_{};
+        std::uint32_t reconfiguration_count_{};
+
+        bool volatile locked_{false};
+    };
+
+}; // namespace Utility
+
+#endif // SPI_BUS_HPP
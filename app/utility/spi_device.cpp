@@ -8,6 +8,16 @@ namespace Utility {
         this->initialize();
     }
 
+    SPIDevice::SPIDevice(SPIBus& spi_bus, GPIO const chip_select) noexcept :
+        SPIDevice{spi_bus, chip_select, spi_bus.get_config()}
+    {}
+
+    SPIDevice::SPIDevice(SPIBus& spi_bus, GPIO const chip_select, SPIConfig const& config) noexcept :
+        chip_select_{chip_select}, spi_bus_{spi_bus.spi_bus()}, bus_{&spi_bus}, config_{config}
+    {
+        this->initialize();
+    }
+
     void SPIDevice::transmit_dword(std::uint32_t const dword) const noexcept
     {
         this->transmit_dwords(std::array<std::uint32_t, 1UL>{dword});
@@ -68,6 +78,11 @@ namespace Utility {
         this->write_bytes(reg_address, std::array<std::uint8_t, 1UL>{byte});
     }
 
+    bool SPIDevice::is_initialized() const noexcept
+    {
+        return this->initialized_;
+    }
+
     std::uint8_t SPIDevice::reg_address_to_read_command(std::uint8_t const reg_address) noexcept
     {
         return reg_address & ~(1U << (std::bit_width(reg_address) - 1U));
@@ -78,6 +93,32 @@ namespace Utility {
         return reg_address | (1U << (std::bit_width(reg_address) - 1U));
     }
 
+    SPIConfig const& SPIDevice::config() const noexcept
+    {
+        return this->config_;
+    }
+
+    bool SPIDevice::acquire_bus() const noexcept
+    {
+        if (this->bus_ == nullptr) {
+            return true;
+        }
+        this->bus_->lock();
+        if (this->bus_->wait() == HAL_TIMEOUT) {
+            this->bus_->unlock();
+            return false;
+        }
+        this->bus_->configure(this->config_);
+        return true;
+    }
+
+    void SPIDevice::release_bus() const noexcept
+    {
+        if (this->bus_ != nullptr) {
+            this->bus_->unlock();
+        }
+    }
+
     void SPIDevice::initialize() noexcept
     {
         if (this->spi_bus_ != nullptr) {
@@ -3,6 +3,7 @@
 
 #include "common.hpp"
 #include "gpio.hpp"
+#include "spi_bus.hpp"
 #include "utility.hpp"
 
 namespace Utility {
@@ -11,6 +12,8 @@ namespace Utility {
     public:
         SPIDevice() noexcept = default;
         SPIDevice(SPIHandle const spi_bus, GPIO const chip_select) noexcept;
+        SPIDevice(SPIBus& spi_bus, GPIO const chip_select) noexcept;
+        SPIDevice(SPIBus& spi_bus, GPIO const chip_select, SPIConfig const& config) noexcept;
 
         SPIDevice(SPIDevice const& other) = delete;
         SPIDevice(SPIDevice&& other) noexcept = default;
@@ -68,12 +71,30 @@ namespace Utility {
         void write_bytes(std::uint8_t const reg_address, std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
         void write_byte(std::uint8_t const reg_address, std::uint8_t const byte) const noexcept;
 
+        template <std::size_t SIZE>
+        std::array<std::uint8_t, SIZE>
+        transmit_receive_bytes(std::array<std::uint8_t, SIZE> const& bytes) const noexcept;
+
+        template <std::size_t SIZE>
+        bool read_bytes_dma(std::uint8_t const reg_address, SPIFrameBuffer<SIZE>& frame_buffer) const noexcept;
+
+        template <std::size_t SIZE>
+        bool write_bytes_dma(std::uint8_t const reg_address,
+                             std::array<std::uint8_t, SIZE> const& bytes,
+                             SPIFrameBuffer<SIZE>& frame_buffer) const noexcept;
+
+        [[nodiscard]] bool is_initialized() const noexcept;
+        [[nodiscard]] SPIConfig const& config() const noexcept;
+
     private:
         static std::uint8_t reg_address_to_read_command(std::uint8_t const reg_address) noexcept;
         static std::uint8_t reg_address_to_write_command(std::uint8_t const reg_address) noexcept;
 
         static constexpr std::uint32_t TIMEOUT{100U};
 
+        [[nodiscard]] bool acquire_bus() const noexcept;
+        void release_bus() const noexcept;
+
         void initialize() noexcept;
         void deinitialize() noexcept;
 
@@ -82,6 +103,8 @@ namespace Utility {
         GPIO chip_select_{};
 
         SPIHandle spi_bus_{nullptr};
+        SPIBus* bus_{nullptr};
+        SPIConfig config_{};
     };
 
     template <std::size_t SIZE>
@@ -100,10 +123,11 @@ namespace Utility {
     void SPIDevice::transmit_bytes(std::array<std::uint8_t, SIZE> const& bytes) const noexcept
     {
         std::array<std::uint8_t, SIZE> transmit{bytes};
-        if (this->initialized_) {
+        if (this->initialized_ && this->acquire_bus()) {
             gpio_write_pin(this->chip_select_, GPIO_PIN_RESET);
             HAL_SPI_Transmit(this->spi_bus_, transmit.data(), transmit.size(), TIMEOUT);
             gpio_write_pin(this->chip_select_, GPIO_PIN_SET);
+            this->release_bus();
         }
     }
 
@@ -123,10 +147,26 @@ namespace Utility {
     std::array<std::uint8_t, SIZE> SPIDevice::receive_bytes() const noexcept
     {
         std::array<std::uint8_t, SIZE> receive{};
-        if (this->initialized_) {
+        if (this->initialized_ && this->acquire_bus()) {
             gpio_write_pin(this->chip_select_, GPIO_PIN_RESET);
             HAL_SPI_Receive(this->spi_bus_, receive.data(), SIZE, TIMEOUT);
             gpio_write_pin(this->chip_select_, GPIO_PIN_SET);
+            this->release_bus();
+        }
+        return receive;
+    }
+
+    template <std::size_t SIZE>
+    std::array<std::uint8_t, SIZE>
+    SPIDevice::transmit_receive_bytes(std::array<std::uint8_t, SIZE> const& bytes) const noexcept
+    {
+        std::array<std::uint8_t, SIZE> transmit{bytes};
+        std::array<std::uint8_t, SIZE> receive{};
+        if (this->initialized_ && this->acquire_bus()) {
+            gpio_write_pin(this->chip_select_, GPIO_PIN_RESET);
+            HAL_SPI_TransmitReceive(this->spi_bus_, transmit.data(), receive.data(), SIZE, TIMEOUT);
+            gpio_write_pin(this->chip_select_, GPIO_PIN_SET);
+            this->release_bus();
         }
         return receive;
     }
@@ -146,13 +186,12 @@ namespace Utility {
     template <std::size_t SIZE>
     std::array<std::uint8_t, SIZE> SPIDevice::read_bytes(std::uint8_t const reg_address) const noexcept
     {
-        std::uint8_t command = reg_address_to_read_command(reg_address);
+        std::array<std::uint8_t, 1UL + SIZE> transmit{};
+        transmit[0] = reg_address_to_read_command(reg_address);
+        auto const receive{this->transmit_receive_bytes(transmit)};
+
         std::array<std::uint8_t, SIZE> read{};
-        if (this->initialized_) {
-            gpio_write_pin(this->chip_select_, GPIO_PIN_RESET);
-            HAL_SPI_TransmitReceive(this->spi_bus_, &command, read.data(), read.size(), TIMEOUT);
-            gpio_write_pin(this->chip_select_, GPIO_PIN_SET);
-        }
+        std::memcpy(read.data(), receive.data() + 1UL, SIZE);
         return read;
     }
 
@@ -178,11 +217,40 @@ namespace Utility {
         std::array<std::uint8_t, 1UL + SIZE> write{};
         std::memcpy(write.data(), &command, 1UL);
         std::memcpy(write.data() + 1UL, bytes.data(), bytes.size());
-        if (this->initialized_) {
+        if (this->initialized_ && this->acquire_bus()) {
             gpio_write_pin(this->chip_select_, GPIO_PIN_RESET);
             HAL_SPI_Transmit(this->spi_bus_, write.data(), write.size(), TIMEOUT);
             gpio_write_pin(this->chip_select_, GPIO_PIN_SET);
+            this->release_bus();
+        }
+    }
+
+    template <std::size_t SIZE>
+    bool SPIDevice::read_bytes_dma(std::uint8_t const reg_address, SPIFrameBuffer<SIZE>& frame_buffer) const noexcept
+    {
+        if (!this->initialized_ || this->bus_ == nullptr) {
+            return false;
+        }
+        frame_buffer.transmit.fill(0U);
+        frame_buffer.transmit[0] = reg_address_to_read_command(reg_address);
+        return this->bus_->enqueue(SPIFrame{.config = this->config_,
+                                            .chip_select = this->chip_select_,
+                                            .transmit = frame_buffer.transmit,
+                                            .receive = frame_buffer.receive});
+    }
+
+    template <std::size_t SIZE>
+    bool SPIDevice::write_bytes_dma(std::uint8_t const reg_address,
+                                    std::array<std::uint8_t, SIZE> const& bytes,
+                                    SPIFrameBuffer<SIZE>& frame_buffer) const noexcept
+    {
+        if (!this->initialized_ || this->bus_ == nullptr) {
+            return false;
         }
+        frame_buffer.transmit[0] = reg_address_to_write_command(reg_address);
+        std::memcpy(frame_buffer.transmit.data() + 1UL, bytes.data(), bytes.size());
+        return this->bus_->enqueue(
+            SPIFrame{.config = this->config_, .chip_select = this->chip_select_, .transmit = frame_buffer.transmit});
     }
 
 }; // namespace Utility
@@ -0,0 +1,74 @@
+#include "crc.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    constexpr std::size_t BENCH_SIZE{1UL << 24U};
+
+    template <std::unsigned_integral UInt, Utility::CRCSpec<UInt> SPEC>
+    UInt bitwise_crc(std::span<std::uint8_t const> const data) noexcept
+    {
+        constexpr auto WIDTH{static_cast<std::uint32_t>(std::numeric_limits<UInt>::digits)};
+        constexpr auto TOP_BIT{static_cast<UInt>(UInt{1U} << (WIDTH - 1U))};
+
+        auto crc{SPEC.init};
+        for (auto const byte : data) {
+            auto const input{SPEC.reflected ? Utility::reflection(byte) : byte};
+            crc = static_cast<UInt>(crc ^ (static_cast<UInt>(input) << (WIDTH - 8U)));
+            for (std::uint8_t bit{}; bit < 8U; ++bit) {
+                crc = static_cast<UInt>((crc & TOP_BIT) != 0U ? (crc << 1U) ^ SPEC.polynomial : crc << 1U);
+            }
+        }
+        if (SPEC.reflected) {
+            crc = Utility::reflection(crc);
+        }
+        return static_cast<UInt>(crc ^ SPEC.xor_out);
+    }
+
+    template <typename Function>
+    double megabytes_per_second(Function&& function, std::size_t const size) noexcept
+    {
+        auto const start{std::chrono::steady_clock::now()};
+        function();
+        auto const seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+        return static_cast<double>(size) / seconds / 1.0E6;
+    }
+
+    template <std::unsigned_integral UInt, Utility::CRCSpec<UInt> SPEC>
+    bool bench(char const* const name, std::span<std::uint8_t const> const data) noexcept
+    {
+        UInt volatile table{};
+        UInt volatile bitwise{};
+        auto const table_rate{megabytes_per_second(
+            [&] { table = Utility::CRCEngine<UInt, SPEC>::calculate(data); }, data.size())};
+        auto const bitwise_rate{
+            megabytes_per_second([&] { bitwise = bitwise_crc<UInt, SPEC>(data); }, data.size())};
+
+        auto const match{table == bitwise};
+        std::printf("%-18s table %8.1f MB/s  bitwise %8.1f MB/s  %s\n",
+                    name,
+                    table_rate,
+                    bitwise_rate,
+                    match ? "match" : "MISMATCH");
+        return match;
+    }
+
+}; // namespace
+
+int main()
+{
+    std::vector<std::uint8_t> data(BENCH_SIZE);
+    for (std::size_t index{}; index < data.size(); ++index) {
+        data[index] = static_cast<std::uint8_t>(index * 131U + (index >> 8U));
+    }
+
+    auto ok{true};
+    ok &= bench<std::uint8_t, Utility::CRC8_MAXIM>("CRC8_MAXIM", data);
+    ok &= bench<std::uint16_t, Utility::CRC16_CCITT_FALSE>("CRC16_CCITT_FALSE", data);
+    ok &= bench<std::uint16_t, Utility::CRC16_MODBUS>("CRC16_MODBUS", data);
+    ok &= bench<std::uint32_t, Utility::CRC32>("CRC32", data);
+    ok &= bench<std::uint32_t, Utility::CRC32_MPEG2>("CRC32_MPEG2", data);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+#include "endian.hpp"
+#include "utility.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    constexpr std::size_t BENCH_SIZE{1UL << 26U};
+    constexpr std::size_t BENCH_ROUNDS{5U};
+
+    constexpr std::array<std::uint8_t, 8UL> ENDIAN_CHECK_BYTES{0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U};
+    constexpr std::array<std::uint32_t, 2UL> ENDIAN_CHECK_DWORDS{0x01020304UL, 0xA0B0C0D0UL};
+    constexpr std::array<std::uint16_t, 2UL> ENDIAN_CHECK_WORDS{0x0102U, 0xA0B0U};
+
+    static_assert(Utility::bytes_to_dwords(ENDIAN_CHECK_BYTES)[1] == 0x05060708UL);
+    static_assert(Utility::bytes_to_dwords(ENDIAN_CHECK_BYTES, std::endian::little)[1] == 0x08070605UL);
+    static_assert(Utility::dwords_to_bytes(ENDIAN_CHECK_DWORDS)[4] == 0xA0U);
+    static_assert(Utility::dwords_to_bytes(ENDIAN_CHECK_DWORDS, std::endian::little)[4] == 0xD0U);
+    static_assert(Utility::bytes_to_dwords(Utility::dwords_to_bytes(ENDIAN_CHECK_DWORDS)) == ENDIAN_CHECK_DWORDS);
+    static_assert(Utility::bytes_to_dwords(Utility::dwords_to_bytes(ENDIAN_CHECK_DWORDS, std::endian::little),
+                                           std::endian::little) == ENDIAN_CHECK_DWORDS);
+    static_assert(Utility::bytes_to_words(ENDIAN_CHECK_BYTES)[1] == 0x0304U);
+    static_assert(Utility::bytes_to_words(Utility::words_to_bytes(ENDIAN_CHECK_WORDS)) == ENDIAN_CHECK_WORDS);
+
+    template <typename Function>
+    double gigabytes_per_second(Function&& function) noexcept
+    {
+        auto const start{std::chrono::steady_clock::now()};
+        for (std::size_t round{}; round < BENCH_ROUNDS; ++round) {
+            function();
+        }
+        auto const seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+        return static_cast<double>(BENCH_ROUNDS * BENCH_SIZE) / seconds / 1.0E9;
+    }
+
+}; // namespace
+
+int main()
+{
+    std::vector<std::uint8_t> bytes(BENCH_SIZE);
+    for (std::size_t index{}; index < bytes.size(); ++index) {
+        bytes[index] = static_cast<std::uint8_t>(index * 131U + (index >> 8U));
+    }
+    std::vector<std::uint32_t> loaded(BENCH_SIZE / 4U);
+    std::vector<std::uint32_t> reference(BENCH_SIZE / 4U);
+    std::vector<std::uint8_t> stored(BENCH_SIZE);
+
+    auto const load_rate{gigabytes_per_second(
+        [&] { Utility::load_endian<std::uint32_t>(bytes, loaded, std::endian::big); })};
+    auto const bytewise_rate{gigabytes_per_second([&] {
+        for (std::size_t index{}; index < reference.size(); ++index) {
+            reference[index] = (static_cast<std::uint32_t>(bytes[4U * index]) << 24U) |
+                               (static_cast<std::uint32_t>(bytes[4U * index + 1U]) << 16U) |
+                               (static_cast<std::uint32_t>(bytes[4U * index + 2U]) << 8U) |
+                               static_cast<std::uint32_t>(bytes[4U * index + 3U]);
+        }
+    })};
+    auto const store_rate{gigabytes_per_second(
+        [&] { Utility::store_endian<std::uint32_t>(loaded, stored, std::endian::big); })};
+
+    auto const match{loaded == reference && stored == bytes};
+    std::printf("load_endian %.2f GB/s  bytewise %.2f GB/s  store_endian %.2f GB/s  %s\n",
+                load_rate,
+                bytewise_rate,
+                store_rate,
+                match ? "match" : "MISMATCH");
+    return match ? 0 : 1;
+}
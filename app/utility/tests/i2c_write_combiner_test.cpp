@@ -0,0 +1,150 @@
+#include "i2c_write_combiner.hpp"
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+    std::uint32_t tick{};
+
+    struct Transfer {
+        bool write{};
+        std::uint8_t reg_address{};
+        std::vector<std::uint8_t> bytes{};
+
+        bool operator==(Transfer const& other) const = default;
+    };
+
+    using Log = std::vector<Transfer>;
+
+    struct FakeTransport {
+    public:
+        FakeTransport() noexcept = default;
+        explicit FakeTransport(Log& log) noexcept : log_{&log}
+        {}
+
+        [[nodiscard]] bool is_initialized() const noexcept
+        {
+            return this->log_ != nullptr;
+        }
+
+        template <std::size_t SIZE>
+        std::array<std::uint8_t, SIZE> read_bytes(std::uint8_t const reg_address) const noexcept
+        {
+            this->log_->push_back(Transfer{false, reg_address, std::vector<std::uint8_t>(SIZE)});
+            return std::array<std::uint8_t, SIZE>{};
+        }
+
+        void write_bytes(std::uint8_t const reg_address, std::span<std::uint8_t const> const bytes) const noexcept
+        {
+            this->log_->push_back(Transfer{true, reg_address, std::vector<std::uint8_t>(bytes.begin(), bytes.end())});
+        }
+
+    private:
+        Log* log_{nullptr};
+    };
+
+    using Combiner = Utility::WriteCombiner<FakeTransport>;
+
+    constexpr std::uint32_t WINDOW_MS{10U};
+
+    int failures{};
+
+    void expect(bool const condition, char const* const what) noexcept
+    {
+        if (!condition) {
+            std::printf("FAIL: %s\n", what);
+            ++failures;
+        }
+    }
+
+    void test_coalescing() noexcept
+    {
+        Log log{};
+        {
+            Combiner combiner{FakeTransport{log}, WINDOW_MS};
+            combiner.write_byte(0x12U, 1U);
+            combiner.write_byte(0x10U, 2U);
+            combiner.write_byte(0x11U, 3U);
+            combiner.write_byte(0x11U, 4U);
+            expect(log.empty(), "writes are buffered until flush");
+            combiner.flush();
+            expect(combiner.stats().dropped_write_count == 1U, "repeated register write is collapsed");
+            expect(combiner.stats().transaction_count == 2U, "only adjacent ascending registers are merged");
+        }
+        expect(log == Log{Transfer{true, 0x12U, {1U}}, Transfer{true, 0x10U, {2U, 4U}}},
+               "writes keep program order and adjacent runs are merged with last values");
+    }
+
+    void test_ordering() noexcept
+    {
+        Log log{};
+        {
+            Combiner combiner{FakeTransport{log}, WINDOW_MS};
+            combiner.write_byte(0x05U, 7U);
+            combiner.write_byte(0x00U, 8U);
+            (void)combiner.read_byte(0x05U);
+            combiner.write_byte(0x01U, 9U);
+            combiner.write_byte(0x00U, 1U);
+            combiner.write_byte(0x01U, 2U);
+        }
+        expect(log == Log{Transfer{true, 0x05U, {7U}},
+                          Transfer{true, 0x00U, {8U}},
+                          Transfer{false, 0x05U, {0U}},
+                          Transfer{true, 0x01U, {9U}},
+                          Transfer{true, 0x00U, {1U, 2U}}},
+               "program order is kept, reads act as a barrier and destruction flushes");
+    }
+
+    void test_window() noexcept
+    {
+        Log log{};
+        Combiner combiner{FakeTransport{log}, WINDOW_MS};
+        tick = 100U;
+        combiner.write_byte(0x02U, 1U);
+        tick += WINDOW_MS - 1U;
+        combiner.poll();
+        expect(log.empty(), "poll inside the window keeps writes buffered");
+        tick += 1U;
+        combiner.poll();
+        expect(log == Log{Transfer{true, 0x02U, {1U}}}, "poll after the window flushes");
+    }
+
+    void test_move() noexcept
+    {
+        Log log{};
+        {
+            Combiner source{FakeTransport{log}, WINDOW_MS};
+            source.write_byte(0x03U, 1U);
+            Combiner target{std::move(source)};
+        }
+        expect(log == Log{Transfer{true, 0x03U, {1U}}}, "moved-from combiner does not replay writes");
+
+        Log target_log{};
+        Log source_log{};
+        {
+            Combiner target{FakeTransport{target_log}, WINDOW_MS};
+            Combiner source{FakeTransport{source_log}, WINDOW_MS};
+            target.write_byte(0x04U, 1U);
+            source.write_byte(0x06U, 2U);
+            target = std::move(source);
+            expect(target_log == Log{Transfer{true, 0x04U, {1U}}}, "move assignment flushes the target first");
+        }
+        expect(source_log == Log{Transfer{true, 0x06U, {2U}}}, "moved writes are sent exactly once");
+    }
+
+}; // namespace
+
+extern "C" std::uint32_t HAL_GetTick(void)
+{
+    return tick;
+}
+
+int main()
+{
+    test_coalescing();
+    test_ordering();
+    test_window();
+    test_move();
+    std::printf("%s\n", failures == 0 ? "OK" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+#include "pwm_device.hpp"
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+namespace {
+
+    struct Range {
+        std::uint16_t min_raw{};
+        std::uint16_t max_raw{};
+        float ref_voltage{};
+    };
+
+    constexpr std::array<Range, 4UL> RANGES{Range{0U, 999U, 3.3F},
+                                            Range{0U, 65535U, 3.3F},
+                                            Range{100U, 4095U, 3.3F},
+                                            Range{0U, 1U, 5.0F}};
+
+    constexpr std::size_t STEPS{1000U};
+    constexpr long MAX_ERROR{1L};
+
+    int failures{};
+
+    void expect(bool const condition, char const* const what, Range const& range) noexcept
+    {
+        if (!condition) {
+            std::printf("FAIL: %s [%u, %u] %.3f V\n", what, range.min_raw, range.max_raw, range.ref_voltage);
+            ++failures;
+        }
+    }
+
+    void test_voltage_to_raw(Range const& range) noexcept
+    {
+        Utility::PWMScale const scale{range.min_raw, range.max_raw, range.ref_voltage};
+        auto const span{static_cast<double>(range.max_raw - range.min_raw)};
+
+        expect(scale.voltage_to_raw(range.ref_voltage) == range.max_raw, "reference voltage maps to max_raw", range);
+        expect(scale.voltage_to_raw(1.0E9F) == range.max_raw, "overvoltage clamps to max_raw", range);
+        expect(scale.voltage_to_raw(std::numeric_limits<float>::infinity()) == range.max_raw,
+               "infinity clamps to max_raw",
+               range);
+        expect(scale.voltage_to_raw(-1.0F) == range.min_raw, "negative voltage clamps to min_raw", range);
+        expect(scale.voltage_to_raw(std::numeric_limits<float>::quiet_NaN()) == range.min_raw,
+               "NaN maps to min_raw",
+               range);
+
+        for (std::size_t step{}; step <= STEPS; ++step) {
+            auto const voltage{range.ref_voltage * static_cast<float>(step) / static_cast<float>(STEPS)};
+            auto const reference{std::lround(range.min_raw + static_cast<double>(voltage) / range.ref_voltage * span)};
+            if (std::labs(reference - static_cast<long>(scale.voltage_to_raw(voltage))) > MAX_ERROR) {
+                expect(false, "voltage_to_raw within one count of the double reference", range);
+                return;
+            }
+        }
+    }
+
+    void test_duty_q15_to_raw(Range const& range) noexcept
+    {
+        Utility::PWMScale const scale{range.min_raw, range.max_raw, range.ref_voltage};
+        auto const span{static_cast<double>(range.max_raw - range.min_raw)};
+
+        expect(scale.duty_q15_to_raw(0x8000U) == range.max_raw, "full duty maps to max_raw", range);
+        expect(scale.duty_q15_to_raw(0xFFFFU) == range.max_raw, "duty above one clamps to max_raw", range);
+
+        for (std::uint32_t duty_q15{}; duty_q15 <= 0x8000U; duty_q15 += 0x40U) {
+            auto const reference{std::lround(range.min_raw + duty_q15 / 32768.0 * span)};
+            auto const raw{static_cast<long>(scale.duty_q15_to_raw(static_cast<std::uint16_t>(duty_q15)))};
+            if (std::labs(reference - raw) > MAX_ERROR) {
+                expect(false, "duty_q15_to_raw within one count of the double reference", range);
+                return;
+            }
+        }
+    }
+
+}; // namespace
+
+int main()
+{
+    for (auto const& range : RANGES) {
+        test_voltage_to_raw(range);
+        test_duty_q15_to_raw(range);
+    }
+    std::printf("%s\n", failures == 0 ? "OK" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
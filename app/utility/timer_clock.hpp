@@ -0,0 +1,31 @@
+#ifndef TIMER_CLOCK_HPP
+#define TIMER_CLOCK_HPP
+
+#include "common.hpp"
+#include "utility.hpp"
+
+namespace Utility {
+
+    [[nodiscard]] inline bool is_apb2_timer(TIM_TypeDef const* const instance) noexcept
+    {
+        return instance == TIM1 || instance == TIM8 || instance == TIM15 || instance == TIM16 || instance == TIM17;
+    }
+
+    [[nodiscard]] inline std::uint32_t timer_clock_frequency(TIM_TypeDef const* const instance) noexcept
+    {
+        if (is_apb2_timer(instance)) {
+            auto const pclk{HAL_RCC_GetPCLK2Freq()};
+            return (RCC->CFGR & RCC_CFGR_PPRE2_2) == 0UL ? pclk : 2UL * pclk;
+        }
+        auto const pclk{HAL_RCC_GetPCLK1Freq()};
+        return (RCC->CFGR & RCC_CFGR_PPRE1_2) == 0UL ? pclk : 2UL * pclk;
+    }
+
+    [[nodiscard]] inline std::uint32_t timer_counter_frequency(TIM_TypeDef const* const instance) noexcept
+    {
+        return timer_clock_frequency(instance) / (instance->PSC + 1UL);
+    }
+
+}; // namespace Utility
+
+#endif // TIMER_CLOCK_HPP
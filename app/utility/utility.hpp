@@ -1,6 +1,7 @@
 #ifndef UTILITY_HPP
 #define UTILITY_HPP
 
+#include "endian.hpp"
 #include <algorithm>
 #include <array>
 #include <bit>
@@ -160,138 +161,117 @@ namespace Utility {
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint16_t, SIZE / 2>
+    constexpr std::array<std::uint16_t, SIZE / 2>
     big_endian_bytes_to_words(std::array<std::uint8_t, SIZE> const& bytes) noexcept
     {
         static_assert(SIZE % 2 == 0);
         std::array<std::uint16_t, SIZE / 2> words{};
-        for (std::size_t i{}; i < words.size(); ++i) {
-            words[i] = static_cast<std::uint16_t>(bytes[2 * i] << 8) | static_cast<std::uint16_t>(bytes[2 * i + 1]);
-        }
+        load_endian<std::uint16_t>(bytes, words, std::endian::big);
         return words;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint16_t, SIZE / 2>
+    constexpr std::array<std::uint16_t, SIZE / 2>
     little_endian_bytes_endian_to_words(std::array<std::uint8_t, SIZE> const& bytes) noexcept
     {
         static_assert(SIZE % 2 == 0);
         std::array<std::uint16_t, SIZE / 2> words{};
-        for (std::size_t i{}; i < words.size(); ++i) {
-            words[i] = static_cast<std::uint16_t>(bytes[2 * i]) | static_cast<std::uint16_t>(bytes[2 * i + 1] << 8);
-        }
+        load_endian<std::uint16_t>(bytes, words, std::endian::little);
         return words;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint16_t, SIZE / 2> bytes_to_words(std::array<std::uint8_t, SIZE> const& bytes,
-                                                              std::endian const endian = std::endian::big) noexcept
+    constexpr std::array<std::uint16_t, SIZE / 2> bytes_to_words(std::array<std::uint8_t, SIZE> const& bytes,
+                                                                 std::endian const endian = std::endian::big) noexcept
     {
-        return endian == std::endian::little ? little_endian_bytes_endian_to_words(bytes)
-                                             : big_endian_bytes_to_words(bytes);
+        static_assert(SIZE % 2 == 0);
+        std::array<std::uint16_t, SIZE / 2> words{};
+        load_endian<std::uint16_t>(bytes, words, endian);
+        return words;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, 2 * SIZE>
+    constexpr std::array<std::uint8_t, 2 * SIZE>
     words_to_big_endian_bytes(std::array<std::uint16_t, SIZE> const& words) noexcept
     {
         std::array<std::uint8_t, 2 * SIZE> bytes{};
-        for (std::size_t i{}; i < words.size(); ++i) {
-            bytes[2 * i] = static_cast<std::uint8_t>(words[i] >> 8);
-            bytes[2 * i + 1] = static_cast<std::uint8_t>(words[i]);
-        }
+        store_endian<std::uint16_t>(words, bytes, std::endian::big);
         return bytes;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, 2 * SIZE>
+    constexpr std::array<std::uint8_t, 2 * SIZE>
     words_to_little_endian_bytes(std::array<std::uint16_t, SIZE> const& words) noexcept
     {
         std::array<std::uint8_t, 2 * SIZE> bytes{};
-        for (std::size_t i{}; i < words.size(); ++i) {
-            bytes[2 * i] = static_cast<std::uint8_t>(words[i]);
-            bytes[2 * i + 1] = static_cast<std::uint8_t>(words[i] >> 8);
-        }
+        store_endian<std::uint16_t>(words, bytes, std::endian::little);
         return bytes;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, 2 * SIZE> words_to_bytes(std::array<std::uint16_t, SIZE> const& words,
-                                                             std::endian const endian = std::endian::big) noexcept
+    constexpr std::array<std::uint8_t, 2 * SIZE> words_to_bytes(std::array<std::uint16_t, SIZE> const& words,
+                                                                std::endian const endian = std::endian::big) noexcept
     {
-        return endian == std::endian::little ? words_to_little_endian_bytes(words) : words_to_big_endian_bytes(words);
+        std::array<std::uint8_t, 2 * SIZE> bytes{};
+        store_endian<std::uint16_t>(words, bytes, endian);
+        return bytes;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint32_t, SIZE / 4>
+    constexpr std::array<std::uint32_t, SIZE / 4>
     big_endian_bytes_to_dwords(std::array<std::uint8_t, SIZE> const& bytes) noexcept
     {
         static_assert(SIZE % 4 == 0);
         std::array<std::uint32_t, SIZE / 4> dwords{};
-        for (std::size_t i{}; i < dwords.size(); ++i) {
-            dwords[i] =
-                static_cast<std::uint32_t>(bytes[2 * i] << 24) | static_cast<std::uint32_t>(bytes[2 * i + 1] << 16) |
-                static_cast<std::uint32_t>(bytes[2 * i + 2] << 8) | static_cast<std::uint32_t>(bytes[2 * i + 3]);
-        }
+        load_endian<std::uint32_t>(bytes, dwords, std::endian::big);
         return dwords;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint32_t, SIZE / 4>
+    constexpr std::array<std::uint32_t, SIZE / 4>
     little_endian_bytes_endian_to_dwords(std::array<std::uint8_t, SIZE> const& bytes) noexcept
     {
         static_assert(SIZE % 4 == 0);
         std::array<std::uint32_t, SIZE / 4> dwords{};
-        for (std::size_t i{}; i < dwords.size(); ++i) {
-            dwords[i] = static_cast<std::uint32_t>(bytes[2 * i]) | static_cast<std::uint32_t>(bytes[2 * i + 1] << 8) |
-                        static_cast<std::uint32_t>(bytes[2 * i + 2] << 16) |
-                        static_cast<std::uint32_t>(bytes[2 * i + 3] << 24);
-        }
+        load_endian<std::uint32_t>(bytes, dwords, std::endian::little);
         return dwords;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint32_t, SIZE / 4> bytes_to_dwords(std::array<std::uint8_t, SIZE> const& bytes,
-                                                               std::endian const endian = std::endian::big) noexcept
+    constexpr std::array<std::uint32_t, SIZE / 4> bytes_to_dwords(std::array<std::uint8_t, SIZE> const& bytes,
+                                                                  std::endian const endian = std::endian::big) noexcept
     {
-        return endian == std::endian::little ? little_endian_bytes_endian_to_dwords(bytes)
-                                             : big_endian_bytes_to_dwords(bytes);
+        static_assert(SIZE % 4 == 0);
+        std::array<std::uint32_t, SIZE / 4> dwords{};
+        load_endian<std::uint32_t>(bytes, dwords, endian);
+        return dwords;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, 4 * SIZE>
+    constexpr std::array<std::uint8_t, 4 * SIZE>
     dwords_to_big_endian_bytes(std::array<std::uint32_t, SIZE> const& dwords) noexcept
     {
         std::array<std::uint8_t, 4 * SIZE> bytes{};
-        for (std::size_t i{}; i < dwords.size(); ++i) {
-            bytes[2 * i] = static_cast<std::uint8_t>(dwords[i] >> 24);
-            bytes[2 * i + 1] = static_cast<std::uint8_t>(dwords[i] >> 16);
-            bytes[2 * i + 2] = static_cast<std::uint8_t>(dwords[i] >> 8);
-            bytes[2 * i + 3] = static_cast<std::uint8_t>(dwords[i]);
-        }
+        store_endian<std::uint32_t>(dwords, bytes, std::endian::big);
         return bytes;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, 4 * SIZE>
+    constexpr std::array<std::uint8_t, 4 * SIZE>
     dwords_to_little_endian_bytes_endian(std::array<std::uint32_t, SIZE> const& dwords) noexcept
     {
         std::array<std::uint8_t, 4 * SIZE> bytes{};
-        for (std::size_t i{}; i < dwords.size(); ++i) {
-            bytes[2 * i] = static_cast<std::uint8_t>(dwords[i]);
-            bytes[2 * i + 1] = static_cast<std::uint8_t>(dwords[i] >> 8);
-            bytes[2 * i + 2] = static_cast<std::uint8_t>(dwords[i] >> 16);
-            bytes[2 * i + 3] = static_cast<std::uint8_t>(dwords[i] >> 24);
-        }
+        store_endian<std::uint32_t>(dwords, bytes, std::endian::little);
         return bytes;
     }
 
     template <std::size_t SIZE>
-    inline std::array<std::uint8_t, 4 * SIZE> dwords_to_bytes(std::array<std::uint32_t, SIZE> const& dwords,
-                                                              std::endian const endian = std::endian::big) noexcept
+    constexpr std::array<std::uint8_t, 4 * SIZE> dwords_to_bytes(std::array<std::uint32_t, SIZE> const& dwords,
+                                                                 std::endian const endian = std::endian::big) noexcept
     {
-        return endian == std::endian::little ? dwords_to_little_endian_bytes_endian(dwords)
-                                             : dwords_to_big_endian_bytes(dwords);
+        std::array<std::uint8_t, 4 * SIZE> bytes{};
+        store_endian<std::uint32_t>(dwords, bytes, endian);
+        return bytes;
     }
 
     template <Arithmetic From, Arithmetic To>
@@ -303,47 +283,16 @@ namespace Utility {
     }
 
     template <std::unsigned_integral UInt>
-    inline UInt reflection(UInt const data) noexcept
+    [[nodiscard]] constexpr UInt reflection(UInt const data) noexcept
     {
+        constexpr auto bits{8U * sizeof(UInt)};
         UInt reflection{};
-        for (std::uint8_t i{}; i < std::bit_width(data); ++i) {
-            write_bit(reflection, read_bit(data, i), std::bit_width(data) - 1U - i);
-        }
-        return reflection;
-    }
-
-    template <std::unsigned_integral UInt, std::size_t SIZE>
-    inline UInt calculate_crc(std::array<std::uint8_t, SIZE> const& data,
-                              UInt const init,
-                              UInt const polynomial,
-                              UInt const xor_out,
-                              bool const reflect_in,
-                              bool const reflect_out) noexcept
-    {
-        UInt crc{init};
-        UInt msb_mask{1U << (std::bit_width(crc) - 1U)};
-        UInt crc_mask{(1U << std::bit_width(crc)) - 1U};
-
-        for (std::uint8_t byte : data) {
-            if (reflect_in) {
-                byte = reflection(byte);
-            }
-            crc ^= byte << (std::bit_width(crc) - 8U);
-
-            for (std::uint8_t bit{}; bit < 8U; ++bit) {
-                if (crc & msb_mask) {
-                    crc = (crc << 1U) ^ polynomial;
-                } else {
-                    crc <<= 1U;
-                }
+        for (std::uint32_t i{}; i < bits; ++i) {
+            if (((data >> i) & 1U) != 0U) {
+                reflection = static_cast<UInt>(reflection | (UInt{1U} << (bits - 1U - i)));
             }
         }
-
-        if (reflect_out) {
-            crc = reflect(crc);
-        }
-        crc ^= xor_out;
-        return crc & crc_mask;
+        return reflection;
     }
 
     inline std::uint32_t count_to_freq_hz(std::uint32_t const count,
@@ -0,0 +1,65 @@
+#ifndef WAVEFORM_HPP
+#define WAVEFORM_HPP
+
+#include "utility.hpp"
+
+namespace Utility {
+
+    [[nodiscard]] constexpr double constexpr_sin(double const radians) noexcept
+    {
+        auto x{radians};
+        while (x > std::numbers::pi) {
+            x -= 2.0 * std::numbers::pi;
+        }
+        while (x < -std::numbers::pi) {
+            x += 2.0 * std::numbers::pi;
+        }
+
+        auto term{x};
+        auto sum{x};
+        for (std::uint32_t order{3U}; order < 24U; order += 2U) {
+            term *= -x * x / static_cast<double>((order - 1U) * order);
+            sum += term;
+        }
+        return sum;
+    }
+
+    template <std::size_t SIZE>
+    [[nodiscard]] constexpr std::array<std::uint16_t, SIZE> make_sine_table(std::uint16_t const min_raw,
+                                                                            std::uint16_t const max_raw) noexcept
+    {
+        std::array<std::uint16_t, SIZE> table{};
+        auto const amplitude{static_cast<double>(max_raw - min_raw) / 2.0};
+        for (std::size_t index{}; index < SIZE; ++index) {
+            auto const phase{2.0 * std::numbers::pi * static_cast<double>(index) / static_cast<double>(SIZE)};
+            table[index] = static_cast<std::uint16_t>(min_raw + amplitude * (1.0 + constexpr_sin(phase)) + 0.5);
+        }
+        return table;
+    }
+
+    template <std::size_t SIZE>
+    [[nodiscard]] constexpr std::array<std::uint16_t, SIZE> make_ramp_table(std::uint16_t const min_raw,
+                                                                            std::uint16_t const max_raw) noexcept
+    {
+        std::array<std::uint16_t, SIZE> table{};
+        for (std::size_t index{}; index < SIZE; ++index) {
+            table[index] = static_cast<std::uint16_t>(min_raw + (max_raw - min_raw) * index / (SIZE - 1UL));
+        }
+        return table;
+    }
+
+    template <std::size_t SIZE>
+    [[nodiscard]] constexpr std::array<std::uint16_t, SIZE> make_triangle_table(std::uint16_t const min_raw,
+                                                                                std::uint16_t const max_raw) noexcept
+    {
+        std::array<std::uint16_t, SIZE> table{};
+        for (std::size_t index{}; index < SIZE; ++index) {
+            auto const distance{index < SIZE / 2UL ? index : SIZE - index};
+            table[index] = static_cast<std::uint16_t>(min_raw + (max_raw - min_raw) * distance / (SIZE / 2UL));
+        }
+        return table;
+    }
+
+}; // namespace Utility
+
+#endif // WAVEFORM_HPP